@@ -0,0 +1,102 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : affichage.c
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Ce fichier implémente l'affichage des listes vers un flux ou
+                  une chaîne, commun aux deux représentations de liste
+
+ Remarque(s)    : Les infos sont converties sans printf et le texte est écrit
+                  par blocs de TAILLE_TAMPON_AFFICHAGE octets
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+#include "affichage_internal.h"
+#include <string.h>
+
+// Taille du tampon utilisé par afficherDans (un seul fwrite pour les listes dont
+// le texte tient dans le tampon)
+#define TAILLE_TAMPON_AFFICHAGE 65536
+
+// Nombre maximal de caractères de la représentation décimale d'une info (signe
+// compris)
+#define TAILLE_MAX_INFO (sizeof(Info) * 3 + 1)
+
+/**
+ * Écrit dans le flux du tampon les caractères en attente
+ * @param tampon tampon vers un flux
+ */
+static void viderTampon(TamponSortie *tampon);
+
+void viderTampon(TamponSortie *tampon) {
+   if (tampon->utilises) {
+      fwrite(tampon->donnees, 1, tampon->utilises, tampon->flux);
+      tampon->utilises = 0;
+   }
+}
+
+void ecrireCaracteres(TamponSortie *tampon, const char *caracteres, size_t nombre) {
+   tampon->total += nombre;
+   // cas courant : les caractères tiennent dans la place restante
+   if (tampon->capacite - tampon->utilises >= nombre) {
+      memcpy(tampon->donnees + tampon->utilises, caracteres, nombre);
+      tampon->utilises += nombre;
+      return;
+   }
+
+   while (nombre) {
+      if (tampon->utilises == tampon->capacite) {
+         if (!tampon->flux) {
+            // chaîne pleine : le reste n'est que compté
+            return;
+         }
+         viderTampon(tampon);
+      }
+      size_t place = tampon->capacite - tampon->utilises;
+      size_t copies = nombre < place ? nombre : place;
+      memcpy(tampon->donnees + tampon->utilises, caracteres, copies);
+      tampon->utilises += copies;
+      caracteres += copies;
+      nombre -= copies;
+   }
+}
+
+void ecrireCaractere(TamponSortie *tampon, char caractere) {
+   ecrireCaracteres(tampon, &caractere, 1);
+}
+
+void ecrireInfo(TamponSortie *tampon, Info info) {
+   // les chiffres sont produits de droite à gauche ; la valeur absolue est
+   // calculée en non signé pour que la plus petite info soit représentable
+   char chiffres[TAILLE_MAX_INFO];
+   char *debut = chiffres + sizeof(chiffres);
+   unsigned valeur = info < 0 ? 0u - (unsigned) info : (unsigned) info;
+   do {
+      *--debut = (char) ('0' + valeur % 10);
+      valeur /= 10;
+   } while (valeur);
+   if (info < 0) {
+      *--debut = '-';
+   }
+   ecrireCaracteres(tampon, debut, (size_t) (chiffres + sizeof(chiffres) - debut));
+}
+
+void afficherDans(FILE *flux, const Liste *liste, Mode mode) {
+   char donnees[TAILLE_TAMPON_AFFICHAGE];
+   TamponSortie tampon = {flux, donnees, sizeof(donnees), 0, 0};
+   formaterListe(&tampon, liste, mode);
+   viderTampon(&tampon);
+}
+
+size_t formaterDansTampon(char *chaine, size_t capacite, const Liste *liste,
+                          Mode mode) {
+   // une place est réservée pour le '\0' final
+   TamponSortie tampon = {NULL, chaine, capacite ? capacite - 1 : 0, 0, 0};
+   formaterListe(&tampon, liste, mode);
+   if (capacite) {
+      chaine[tampon.utilises] = '\0';
+   }
+   return tampon.total;
+}
@@ -0,0 +1,67 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : affichage_internal.h
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : En-tête privé de l'affichage des listes : tampon de sortie
+                  commun aux deux représentations de liste
+
+ Remarque(s)    : Ce fichier ne doit pas être inclus ailleurs que les fichiers
+                  source de la librairie
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+
+#ifndef AFFICHAGE_INTERNAL_H
+#define AFFICHAGE_INTERNAL_H
+
+#include "listes_dynamiques.h"
+#include <stdio.h>
+
+/**
+ * Tampon dans lequel le texte d'une liste est produit. Vers un flux, le tampon
+ * est vidé (fwrite) chaque fois qu'il est plein ; vers une chaîne, le texte qui
+ * ne tient pas est compté mais pas écrit.
+ */
+typedef struct {
+   FILE *flux;        // NULL pour une sortie dans une chaîne
+   char *donnees;
+   size_t capacite;   // sans le '\0' final dans le cas d'une chaîne
+   size_t utilises;
+   size_t total;      // caractères produits, y compris ceux non écrits
+} TamponSortie;
+
+/**
+ * Ajoute nombre caractères au tampon
+ * @param tampon
+ * @param caracteres caractères à ajouter
+ * @param nombre nombre de caractères
+ */
+void ecrireCaracteres(TamponSortie *tampon, const char *caracteres, size_t nombre);
+
+/**
+ * Ajoute un caractère au tampon
+ * @param tampon
+ * @param caractere caractère à ajouter
+ */
+void ecrireCaractere(TamponSortie *tampon, char caractere);
+
+/**
+ * Ajoute au tampon la représentation décimale de info (identique à "%d")
+ * @param tampon
+ * @param info info à ajouter
+ */
+void ecrireInfo(TamponSortie *tampon, Info info);
+
+/**
+ * Produit dans tampon le texte de liste tel qu'affiché par afficher. Implémentée
+ * par chaque représentation de liste.
+ * @param tampon
+ * @param liste liste à formater
+ * @param mode sens du parcours
+ */
+void formaterListe(TamponSortie *tampon, const Liste *liste, Mode mode);
+
+#endif //AFFICHAGE_INTERNAL_H
@@ -0,0 +1,1718 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : benchmark.c
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Mesures de performance de la librairie de listes doublement
+                  chaînées non circulaires.
+
+ Remarque(s)    : Les mesures n'ont de sens que si la librairie est compilée en
+                  mode Release (cmake -DCMAKE_BUILD_TYPE=Release).
+                  Utilisation : Labo_2_benchmark [nombre d'elements]
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "listes_dynamiques.h"
+#include "deque_concurrente.h"
+#include "deque_vol.h"
+#include "listes_intrusives.h"
+#include "persistance.h"
+#include "listes_generiques.h"
+#include "listes_variables.h"
+
+#ifndef LISTES_DEROULEES
+#include "listes_paralleles.h"
+#include "restitution_differee.h"
+#endif
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+// Nombre d'elements par defaut des listes mesurées
+const size_t BENCHMARK_NOMBRE_ELEMENTS = 1000000;
+
+// Blocs assez grands pour être alloués hors du tas et rendus au systeme
+const size_t BENCHMARK_ELEMENTS_PAR_BLOC = 65536;
+
+/**
+ * @return l'instant actuel en secondes
+ */
+double maintenant(void);
+
+/**
+ * @return la memoire physique (RSS) utilisée par le processus en kilo-octets ou 0
+ * si elle ne peut pas être déterminée sur cette plateforme
+ */
+size_t memoireResidente(void);
+
+/**
+ * Mesure l'insertion en queue de nombre elements puis leur suppression en tete
+ * et affiche le debit obtenu ainsi que la memoire occupée par la liste pleine
+ * @param nom nom de la variante mesurée
+ * @param liste liste vide sur laquelle effectuer la mesure
+ * @param nombre nombre d'elements à inserer
+ */
+void mesurerInsertionSuppression(const char *nom, Liste *liste, size_t nombre);
+
+/**
+ * Critere de suppression des elements dont la position est impaire
+ * @param position position dans la liste
+ * @param info info de l'element
+ * @return true si position est impaire, false sinon
+ */
+bool positionEstImpaire(size_t position, const Info *info);
+
+/**
+ * Mesure les parcours (longueur, sontEgales, supprimerSelonCritere) et la
+ * memoire occupée par element. À comparer entre une compilation classique et une
+ * compilation avec LISTES_DEROULEES.
+ * @param nombre nombre d'elements des listes mesurées
+ */
+void benchmarkParcours(size_t nombre);
+
+/**
+ * Compare afficherDans à un affichage faisant deux fprintf par info (comme
+ * afficher avant l'introduction du tampon), vers un fichier temporaire
+ * @param nombre nombre d'elements de la liste mesurée
+ */
+void benchmarkAffichage(size_t nombre);
+
+/**
+ * Compare la construction d'une liste par insererEnQueue à
+ * insererTableauEnQueue, puis mesure versTableau (memcpy comme référence) et la
+ * destruction des deux listes
+ * @param nombre nombre d'elements de la liste mesurée
+ */
+void benchmarkTableaux(size_t nombre);
+
+/**
+ * Compare la fusion de listes (une par thread) en une seule par suppression et
+ * reinsertion de chaque info à concatener, puis mesure couperA au milieu
+ * @param nombre nombre total d'elements des listes mesurées
+ */
+void benchmarkConcatener(size_t nombre);
+
+// Fichier écrit (puis supprimé) par benchmarkPersistance
+#define BENCHMARK_FICHIER_PERSISTANCE "benchmark_persistance.bin"
+
+/**
+ * Compare la reconstruction d'une liste depuis son texte (tel qu'écrit par
+ * afficherDans, relu avec fscanf) à charger et à projeter, suivi d'un parcours
+ * complet de la liste projetée (sontEgalesProjetee)
+ * @param nombre nombre d'elements de la liste mesurée
+ */
+void benchmarkPersistance(size_t nombre);
+
+/**
+ * Liste utilisée comme file entre threads en protégeant chaque appel par un
+ * verrou global (référence pour la deque concurrente)
+ */
+typedef struct {
+   Liste *liste;
+   pthread_mutex_t verrou;
+   pthread_cond_t nonVide;
+} ListeVerrouillee;
+
+/**
+ * Travail d'un thread de benchmarkDequeConcurrente
+ */
+typedef struct {
+   DequeConcurrente *deque;            // NULL : utiliser listeVerrouillee
+   ListeVerrouillee *listeVerrouillee;
+   size_t operations;                  // insertions ou suppressions à effectuer
+   int role;                           // PRODUCTEUR, CONSOMMATEUR ou les deux
+} TravailFile;
+
+enum {
+   PRODUCTEUR = 1, CONSOMMATEUR = 2
+};
+
+/**
+ * Effectue les insertions en queue (producteur) et/ou suppressions bloquantes en
+ * tete (consommateur) d'un travail
+ * @param argument TravailFile
+ * @return NULL
+ */
+void *travaillerFile(void *argument);
+
+/**
+ * Mesure le debit (operations par seconde) d'une file multi-producteurs
+ * multi-consommateurs de 1 à 16 threads, avec une Liste et un verrou global puis
+ * avec la deque concurrente
+ * @param nombre nombre d'infos transitant par la file
+ */
+void benchmarkDequeConcurrente(size_t nombre);
+
+/**
+ * Etat partagé par les threads de benchmarkVolDeTravail
+ */
+typedef struct {
+   DequeVol **deques;         // une deque par thread
+   size_t threads;
+   bool vol;                  // false : chaque thread ne traite que sa deque
+   atomic_size_t restantes;   // taches inserées mais pas encore traitées
+} ForkJoin;
+
+/**
+ * Travail d'un thread de benchmarkVolDeTravail
+ */
+typedef struct {
+   ForkJoin *forkJoin;
+   size_t numero;             // indice de la deque du thread
+   size_t feuilles;           // taches feuilles traitées par le thread
+   unsigned long long somme;  // resultat du travail des feuilles
+} TravailForkJoin;
+
+/**
+ * Traite les taches de sa deque : une tache de profondeur p > 0 se divise en
+ * deux taches de profondeur p - 1 (fork), une tache de profondeur 0 effectue
+ * un calcul. Une fois sa deque vide, vole les taches des autres threads si le
+ * vol est permis, jusqu'à ce que toutes les taches soient traitées (join).
+ * @param argument TravailForkJoin
+ * @return NULL
+ */
+void *travaillerForkJoin(void *argument);
+
+/**
+ * Mesure un calcul fork/join dont toutes les taches naissent dans la deque du
+ * premier thread, de 1 à 8 threads, sans puis avec vol de travail, et affiche
+ * la repartition des feuilles entre les threads
+ * @param nombre nombre approximatif de taches feuilles
+ */
+void benchmarkVolDeTravail(size_t nombre);
+
+/**
+ * Enregistrement d'un tableau de l'appelant, chaîné par benchmarkListeIntrusive
+ */
+typedef struct {
+   Info info;
+   Maillon lien;
+} EnregistrementIntrusif;
+
+/**
+ * Compare le passage d'enregistrements d'un tableau dans une Liste (copie de
+ * l'info dans un element alloué) au chaînage des mêmes enregistrements dans une
+ * liste intrusive
+ * @param nombre nombre d'enregistrements
+ */
+void benchmarkListeIntrusive(size_t nombre);
+
+// Liste de pointeurs sur des chaînes allouées à part, référence de
+// benchmarkListeVariable
+CREER_LISTE_GENERIQUE(ListeChaines, char *, VALEURS_EGALES)
+
+/**
+ * Compare une liste de chaînes de caractères allouées séparément de leurs
+ * elements (deux allocations par chaîne) à une liste à données de taille
+ * variable (une allocation) : construction, parcours et destruction
+ * @param nombre nombre de chaînes
+ */
+void benchmarkListeVariable(size_t nombre);
+
+#ifndef LISTES_DEROULEES
+/**
+ * Compare l'allocation des elements un à un (calloc/free) à l'allocation depuis
+ * un reservoir d'elements
+ * @param nombre nombre d'elements des listes mesurées
+ */
+void benchmarkReservoir(size_t nombre);
+
+/**
+ * Compare l'acces positionnel (elementA, vider) par parcours lineaire à l'acces
+ * via un index positionnel
+ * @param nombre nombre d'elements de la liste mesurée
+ */
+void benchmarkIndexPositionnel(size_t nombre);
+
+/**
+ * Mesure nombreAcces appels à elementA à des positions pseudo-aléatoires puis
+ * nombreAcces appels à vider retirant chacun le dernier element
+ * @param nom nom de la variante mesurée
+ * @param liste liste d'au moins nombreAcces elements
+ * @param nombreAcces nombre d'appels mesurés
+ */
+void mesurerAccesPositionnel(const char *nom, Liste *liste, size_t nombreAcces);
+
+/**
+ * Critere par lot supprimant les infos qui ne sont pas comprises entre 3 et 7
+ * @param positionDebut position de la premiere info du lot
+ * @param infos infos du lot
+ * @param nombre nombre d'infos du lot
+ * @param aSupprimer true pour chaque info à supprimer
+ */
+void horsDe3a7ParLot(size_t positionDebut, const Info *infos, size_t nombre,
+                     bool *aSupprimer);
+
+/**
+ * Critere supprimant les infos qui ne sont pas comprises entre 3 et 7
+ * @param position position dans la liste
+ * @param info info de l'element
+ * @return true si info n'est pas comprise entre 3 et 7
+ */
+bool horsDe3a7(size_t position, const Info *info);
+
+/**
+ * Compare supprimerSelonCritere à supprimerSelonCritereParLot
+ * @param nombre nombre d'elements de la liste mesurée
+ */
+void benchmarkCritereParLot(size_t nombre);
+
+/**
+ * Mesure supprimerSelonCritereParallele de 1 à 8 threads
+ * @param nombre nombre d'elements de la liste mesurée
+ */
+void benchmarkCritereParallele(size_t nombre);
+
+/**
+ * Mesure la construction d'une liste à partir d'un tableau : insererEnQueue
+ * appelé pour chaque info, insererTableauEnQueue, puis
+ * insererTableauEnQueueParallele de 1 à 8 threads, dans une liste vide (un seul
+ * bloc) et dans une liste non vide sans reservoir (elements alloués un à un)
+ * @param nombre nombre d'infos du tableau
+ */
+void benchmarkConstructionParallele(size_t nombre);
+
+/**
+ * Mesure, de 1 à 8 threads, compterSelonCritereParallele, sontEgalesParallele
+ * et replierParallele (somme des infos) sur des listes sans aide au découpage
+ * (parcours), avec un répertoire de segments, puis avec un index positionnel
+ * @param nombre nombre d'elements des listes mesurées
+ */
+void benchmarkLecturesParalleles(size_t nombre);
+
+/**
+ * Accumulation de replierParallele : ajoute info à la somme
+ * @param partiel long long contenant la somme
+ * @param position non utilisée
+ * @param info
+ */
+void accumulerSomme(void *partiel, size_t position, const Info *info);
+
+/**
+ * Combinaison de replierParallele : ajoute une somme partielle à la somme
+ * @param resultat long long contenant la somme
+ * @param partiel long long contenant la somme partielle
+ */
+void combinerSommes(void *resultat, const void *partiel);
+
+/**
+ * Compare sontEgales sans et avec empreinte sur toutes les paires d'un ensemble
+ * de listes de même longueur ne différant que par leur derniere info
+ * @param nombre nombre total d'elements des listes mesurées
+ */
+void benchmarkEmpreinte(size_t nombre);
+
+/**
+ * Compare une passe d'edition (suppression des multiples de 3, insertion d'une
+ * info après chaque multiple de 10) faite avec un curseur à la reconstruction de
+ * la liste via un tableau, seule alternative sans curseur
+ * @param nombre nombre d'elements de la liste mesurée
+ */
+void benchmarkCurseur(size_t nombre);
+
+/**
+ * Comparateur d'infos pour qsort
+ * @param a Info
+ * @param b Info
+ * @return négatif, nul ou positif selon que a est inférieure, égale ou
+ * supérieure à b
+ */
+int comparerInfos(const void *a, const void *b);
+
+/**
+ * Compare le tri d'une liste d'infos pseudo-aléatoires par trier à la copie dans
+ * un tableau trié par qsort puis recopié dans la liste
+ * @param nombre nombre d'elements de la liste mesurée
+ */
+void benchmarkTri(size_t nombre);
+
+/**
+ * Compare la latence de vider sur une liste sans reservoir avec restitution
+ * immédiate, différée en arrière-plan et différée par tranches restituées par
+ * l'appelant
+ * @param nombre nombre d'elements de la liste mesurée
+ */
+void benchmarkRestitutionDifferee(size_t nombre);
+
+/**
+ * Construit, element par element (donc sans reservoir), une liste de nombre
+ * elements
+ * @param nombre
+ * @return la liste ou NULL en cas de mémoire insuffisante
+ */
+Liste *construireSansReservoir(size_t nombre);
+
+/**
+ * Compare la durée d'un parcours (somme des infos et sontEgales) d'une liste
+ * fragmentée par de nombreuses insertions et suppressions en tete et en queue,
+ * avant et après compacter
+ * @param nombre nombre d'elements de la liste mesurée
+ */
+void benchmarkCompactage(size_t nombre);
+
+/**
+ * Mesure un parcours de liste (somme des infos) et sa comparaison avec copie
+ * @param nom nom de la mesure affiché
+ * @param liste
+ * @param copie liste de même contenu que liste
+ */
+void mesurerParcoursFragmente(const char *nom, const Liste *liste,
+                              const Liste *copie);
+
+/**
+ * Mesure, de 1 à 32 threads modifiant chacun leur propre liste sans reservoir
+ * (insertions et suppressions en tete et en queue), la durée totale avec et sans
+ * caches d'elements par thread
+ * @param nombre nombre total d'insertions, réparties entre les threads
+ */
+void benchmarkCachesElements(size_t nombre);
+
+/**
+ * Travail d'un thread de benchmarkCachesElements : vagues de 256 insertions
+ * suivies de 256 suppressions, en tete ou en queue selon un tirage
+ * pseudo-aléatoire
+ * @param argument pointeur sur le nombre d'insertions (size_t) à effectuer
+ * @return NULL
+ */
+void *modifierListePropre(void *argument);
+#endif
+
+int main(int argc, char *argv[]) {
+   size_t nombre = BENCHMARK_NOMBRE_ELEMENTS;
+   if (argc > 1) {
+      nombre = (size_t) strtoull(argv[1], NULL, 10);
+   }
+   benchmarkParcours(nombre);
+   benchmarkAffichage(nombre);
+   benchmarkTableaux(nombre);
+   benchmarkConcatener(nombre);
+   benchmarkPersistance(nombre);
+   benchmarkDequeConcurrente(nombre);
+   benchmarkVolDeTravail(nombre);
+   benchmarkListeIntrusive(nombre);
+   benchmarkListeVariable(nombre);
+#ifndef LISTES_DEROULEES
+   benchmarkReservoir(nombre);
+   benchmarkIndexPositionnel(nombre);
+   benchmarkCritereParLot(nombre);
+   benchmarkCritereParallele(nombre);
+   benchmarkConstructionParallele(nombre);
+   benchmarkLecturesParalleles(nombre);
+   benchmarkEmpreinte(nombre);
+   benchmarkCurseur(nombre);
+   benchmarkTri(nombre);
+   benchmarkRestitutionDifferee(nombre);
+   benchmarkCompactage(nombre);
+   benchmarkCachesElements(nombre);
+#endif
+   return EXIT_SUCCESS;
+}
+
+double maintenant(void) {
+   struct timespec instant;
+   timespec_get(&instant, TIME_UTC);
+   return (double) instant.tv_sec + (double) instant.tv_nsec / 1e9;
+}
+
+size_t memoireResidente(void) {
+   size_t pages = 0;
+#ifdef __linux__
+   FILE *statm = fopen("/proc/self/statm", "r");
+   if (statm) {
+      size_t total;
+      if (fscanf(statm, "%zu %zu", &total, &pages) != 2) {
+         pages = 0;
+      }
+      fclose(statm);
+   }
+   return pages * (size_t) sysconf(_SC_PAGESIZE) / 1024;
+#else
+   return pages;
+#endif
+}
+
+void mesurerInsertionSuppression(const char *nom, Liste *liste, size_t nombre) {
+   size_t memoireAvant = memoireResidente();
+
+   double debut = maintenant();
+   for (size_t i = 0; i < nombre; i++) {
+      Info info = (Info) i;
+      if (insererEnQueue(liste, &info) != OK) {
+         printf("%s : memoire insuffisante\n", nom);
+         return;
+      }
+   }
+   double insertion = maintenant() - debut;
+   size_t memoirePleine = memoireResidente();
+
+   debut = maintenant();
+   while (supprimerEnTete(liste, NULL) == OK);
+   double suppression = maintenant() - debut;
+
+   printf("%-10s insertion : %8.2f Mops/s  suppression : %8.2f Mops/s  "
+          "RSS : %zu kio\n", nom, (double) nombre / insertion / 1e6,
+          (double) nombre / suppression / 1e6,
+          memoirePleine > memoireAvant ? memoirePleine - memoireAvant : 0);
+}
+
+bool positionEstImpaire(size_t position, const Info *info) {
+   (void) info; //eviter le warning de parametre non utilise
+   return position % 2;
+}
+
+void benchmarkParcours(size_t nombre) {
+#ifdef LISTES_DEROULEES
+   printf("Parcours (liste deroulee), %zu elements\n", nombre);
+#else
+   printf("Parcours (liste classique), %zu elements\n", nombre);
+#endif
+   Liste *l1 = initialiser();
+   Liste *l2 = initialiser();
+   if (!l1 || !l2) {
+      free(l1);
+      free(l2);
+      return;
+   }
+
+   size_t memoireAvant = memoireResidente();
+   for (size_t i = 0; i < nombre; i++) {
+      Info info = (Info) i;
+      if (insererEnQueue(l1, &info) != OK || insererEnQueue(l2, &info) != OK) {
+         printf("memoire insuffisante\n");
+         detruire(l1);
+         detruire(l2);
+         return;
+      }
+   }
+   size_t memoire = memoireResidente() - memoireAvant;
+   printf("memoire par element : %.2f octets\n",
+          (double) memoire * 1024 / (double) (2 * nombre));
+
+   double debut = maintenant();
+   size_t taille = longueur(l1);
+   double duree = maintenant() - debut;
+   printf("longueur              : %8.2f ms (%zu elements)\n", duree * 1e3, taille);
+
+   debut = maintenant();
+   bool egales = sontEgales(l1, l2);
+   duree = maintenant() - debut;
+   printf("sontEgales            : %8.2f ms (%s)\n", duree * 1e3,
+          egales ? "egales" : "differentes");
+
+   debut = maintenant();
+   supprimerSelonCritere(l1, positionEstImpaire);
+   duree = maintenant() - debut;
+   printf("supprimerSelonCritere : %8.2f ms (%zu restants)\n", duree * 1e3,
+          longueur(l1));
+
+   detruire(l1);
+   detruire(l2);
+}
+
+void benchmarkAffichage(size_t nombre) {
+   printf("Affichage, %zu elements\n", nombre);
+   Liste *liste = initialiser();
+   FILE *flux = tmpfile();
+   if (!liste || !flux) {
+      free(liste);
+      if (flux) {
+         fclose(flux);
+      }
+      return;
+   }
+   for (size_t i = 0; i < nombre; i++) {
+      Info info = (Info) (i * 2654435761u);
+      if (insererEnQueue(liste, &info) != OK) {
+         printf("memoire insuffisante\n");
+         break;
+      }
+   }
+
+   double debut = maintenant();
+   fprintf(flux, "%c", '[');
+   for (size_t i = 0; i < nombre; i++) {
+      if (i) {
+         fprintf(flux, "%c", ',');
+      }
+      fprintf(flux, "%d", (Info) (i * 2654435761u));
+   }
+   fprintf(flux, "%c", ']');
+   fflush(flux);
+   double duree = maintenant() - debut;
+   long tailleFprintf = ftell(flux);
+   printf("fprintf      : %8.2f ms (%ld octets)\n", duree * 1e3, tailleFprintf);
+
+   rewind(flux);
+   debut = maintenant();
+   afficherDans(flux, liste, FORWARD);
+   fflush(flux);
+   duree = maintenant() - debut;
+   printf("afficherDans : %8.2f ms (%ld octets)\n", duree * 1e3, ftell(flux));
+
+   fclose(flux);
+   detruire(liste);
+}
+
+void benchmarkTableaux(size_t nombre) {
+   printf("Tableaux, %zu elements\n", nombre);
+   Info *source = (Info *) malloc(nombre * sizeof(Info));
+   Info *destination = (Info *) malloc(nombre * sizeof(Info));
+   Liste *l1 = initialiser();
+   Liste *l2 = initialiser();
+   if (!source || !destination || !l1 || !l2) {
+      free(source);
+      free(destination);
+      free(l1);
+      free(l2);
+      return;
+   }
+   for (size_t i = 0; i < nombre; i++) {
+      source[i] = (Info) i;
+   }
+
+   double debut = maintenant();
+   for (size_t i = 0; i < nombre; i++) {
+      if (insererEnQueue(l1, &source[i]) != OK) {
+         printf("memoire insuffisante\n");
+         break;
+      }
+   }
+   double duree = maintenant() - debut;
+   printf("insererEnQueue        : %8.2f ms\n", duree * 1e3);
+
+   debut = maintenant();
+   if (insererTableauEnQueue(l2, source, nombre) != OK) {
+      printf("memoire insuffisante\n");
+   }
+   duree = maintenant() - debut;
+   printf("insererTableauEnQueue : %8.2f ms\n", duree * 1e3);
+
+   debut = maintenant();
+   size_t copies = versTableau(l2, destination, nombre);
+   duree = maintenant() - debut;
+   printf("versTableau           : %8.2f ms (%zu infos)\n", duree * 1e3, copies);
+
+   debut = maintenant();
+   memcpy(destination, source, nombre * sizeof(Info));
+   duree = maintenant() - debut;
+   printf("memcpy                : %8.2f ms\n", duree * 1e3);
+
+   debut = maintenant();
+   detruire(l1);
+   duree = maintenant() - debut;
+   printf("detruire (insererEnQueue)        : %8.2f ms\n", duree * 1e3);
+
+   debut = maintenant();
+   detruire(l2);
+   duree = maintenant() - debut;
+   printf("detruire (insererTableauEnQueue) : %8.2f ms\n", duree * 1e3);
+
+   free(source);
+   free(destination);
+}
+
+void benchmarkConcatener(size_t nombre) {
+   enum { NOMBRE_LISTES = 8 };
+   printf("Concatenation, %d listes, %zu elements\n", NOMBRE_LISTES, nombre);
+   for (int variante = 0; variante < 2; variante++) {
+      Liste *listes[NOMBRE_LISTES] = {NULL};
+      for (size_t i = 0; i < NOMBRE_LISTES; i++) {
+         listes[i] = initialiser();
+         // insererEnQueue : pas de reservoir privé, les elements peuvent être
+         // rechaînés d'une liste à l'autre
+         for (size_t j = 0; listes[i] && j < nombre / NOMBRE_LISTES; j++) {
+            Info info = (Info) j;
+            insererEnQueue(listes[i], &info);
+         }
+      }
+      Liste *resultat = initialiser();
+      bool alloue = resultat != NULL;
+      for (size_t i = 0; i < NOMBRE_LISTES; i++) {
+         alloue = alloue && listes[i] && longueur(listes[i]) == nombre / NOMBRE_LISTES;
+      }
+
+      double debut = maintenant();
+      for (size_t i = 0; alloue && i < NOMBRE_LISTES; i++) {
+         if (variante) {
+            concatener(resultat, listes[i]);
+         } else {
+            Info info;
+            while (supprimerEnTete(listes[i], &info) == OK) {
+               insererEnQueue(resultat, &info);
+            }
+         }
+      }
+      double duree = maintenant() - debut;
+      printf("%-23s : %8.3f ms\n",
+             variante ? "concatener" : "supprimer et inserer", duree * 1e3);
+
+      if (!alloue) {
+         printf("memoire insuffisante\n");
+      } else if (variante) {
+         debut = maintenant();
+         Liste *moitie = couperA(resultat, longueur(resultat) / 2);
+         duree = maintenant() - debut;
+         printf("%-23s : %8.3f ms\n", "couperA (milieu)", duree * 1e3);
+         detruire(moitie);
+      }
+      detruire(resultat);
+      for (size_t i = 0; i < NOMBRE_LISTES; i++) {
+         detruire(listes[i]);
+      }
+   }
+}
+
+void benchmarkPersistance(size_t nombre) {
+   printf("Persistance, %zu elements\n", nombre);
+   Liste *liste = initialiser();
+   Liste *relue = initialiser();
+   Liste *chargee = initialiser();
+   FILE *texte = tmpfile();
+   FILE *binaire = fopen(BENCHMARK_FICHIER_PERSISTANCE, "wb");
+   if (!liste || !relue || !chargee || !texte || !binaire) {
+      free(liste);
+      free(relue);
+      free(chargee);
+      if (texte) {
+         fclose(texte);
+      }
+      if (binaire) {
+         fclose(binaire);
+      }
+      return;
+   }
+   for (size_t i = 0; i < nombre; i++) {
+      Info info = (Info) (i * 2654435761u);
+      if (insererEnQueue(liste, &info) != OK) {
+         printf("memoire insuffisante\n");
+         break;
+      }
+   }
+   afficherDans(texte, liste, FORWARD);
+   Status status = sauvegarder(liste, binaire);
+   fclose(binaire);
+   if (status != OK) {
+      printf("erreur d'ecriture\n");
+   }
+
+   rewind(texte);
+   double debut = maintenant();
+   Info info;
+   char separateur = (char) fgetc(texte);
+   while (separateur != ']' && fscanf(texte, "%d%c", &info, &separateur) == 2) {
+      insererEnQueue(relue, &info);
+   }
+   double duree = maintenant() - debut;
+   printf("texte (fscanf)             : %10.3f ms (%s)\n", duree * 1e3,
+          sontEgales(liste, relue) ? "identique" : "DIFFERENT");
+
+   binaire = fopen(BENCHMARK_FICHIER_PERSISTANCE, "rb");
+   debut = maintenant();
+   status = binaire ? charger(chargee, binaire) : ERREUR_FICHIER;
+   duree = maintenant() - debut;
+   printf("charger                    : %10.3f ms (%s)\n", duree * 1e3,
+          status == OK && sontEgales(liste, chargee) ? "identique" : "DIFFERENT");
+   if (binaire) {
+      fclose(binaire);
+   }
+
+   debut = maintenant();
+   ListeProjetee *projetee = projeter(BENCHMARK_FICHIER_PERSISTANCE);
+   size_t longueurProjection = projetee ? longueurProjetee(projetee) : 0;
+   duree = maintenant() - debut;
+   printf("projeter + longueur        : %10.3f ms (%zu infos)\n", duree * 1e3,
+          longueurProjection);
+
+   debut = maintenant();
+   bool egales = projetee && sontEgalesProjetee(liste, projetee);
+   duree = maintenant() - debut;
+   printf("sontEgalesProjetee         : %10.3f ms (%s)\n", duree * 1e3,
+          egales ? "identique" : "DIFFERENT");
+
+   detruireProjetee(projetee);
+   remove(BENCHMARK_FICHIER_PERSISTANCE);
+   fclose(texte);
+   detruire(liste);
+   detruire(relue);
+   detruire(chargee);
+}
+
+void *travaillerFile(void *argument) {
+   TravailFile *travail = (TravailFile *) argument;
+   ListeVerrouillee *file = travail->listeVerrouillee;
+   for (size_t i = 0; i < travail->operations; i++) {
+      Info info = (Info) i;
+      if (travail->role & PRODUCTEUR) {
+         if (travail->deque) {
+            insererEnQueueDeque(travail->deque, &info);
+         } else {
+            pthread_mutex_lock(&file->verrou);
+            insererEnQueue(file->liste, &info);
+            pthread_cond_signal(&file->nonVide);
+            pthread_mutex_unlock(&file->verrou);
+         }
+      }
+      if (travail->role & CONSOMMATEUR) {
+         if (travail->deque) {
+            supprimerEnTeteDequeBloquant(travail->deque, &info);
+         } else {
+            pthread_mutex_lock(&file->verrou);
+            while (supprimerEnTete(file->liste, &info) != OK) {
+               pthread_cond_wait(&file->nonVide, &file->verrou);
+            }
+            pthread_mutex_unlock(&file->verrou);
+         }
+      }
+   }
+   return NULL;
+}
+
+void benchmarkDequeConcurrente(size_t nombre) {
+   enum { THREADS_MAX = 16 };
+   printf("File multi-producteurs multi-consommateurs, %zu infos\n", nombre);
+   ListeVerrouillee listeVerrouillee = {initialiser(), PTHREAD_MUTEX_INITIALIZER,
+                                        PTHREAD_COND_INITIALIZER};
+   DequeConcurrente *deque = initialiserDeque();
+   if (!listeVerrouillee.liste || !deque) {
+      free(listeVerrouillee.liste);
+      detruireDeque(deque);
+      return;
+   }
+
+   const char *variantes[] = {"verrou global", "deque"};
+   for (size_t variante = 0; variante < 2; variante++) {
+      for (size_t threads = 1; threads <= THREADS_MAX; threads *= 2) {
+         // un seul thread alterne insertion et suppression, sinon la moitié des
+         // threads produit et l'autre consomme
+         size_t paires = threads / 2 ? threads / 2 : 1;
+         pthread_t identifiants[THREADS_MAX];
+         TravailFile travaux[THREADS_MAX];
+         for (size_t i = 0; i < threads; i++) {
+            travaux[i] = (TravailFile) {
+               variante ? deque : NULL, &listeVerrouillee, nombre / paires,
+               threads == 1 ? PRODUCTEUR | CONSOMMATEUR
+                            : (i % 2 ? CONSOMMATEUR : PRODUCTEUR)
+            };
+         }
+
+         double debut = maintenant();
+         size_t crees = 0;
+         while (crees < threads &&
+                !pthread_create(&identifiants[crees], NULL, travaillerFile,
+                                &travaux[crees])) {
+            crees++;
+         }
+         for (size_t i = 0; i < crees; i++) {
+            pthread_join(identifiants[i], NULL);
+         }
+         double duree = maintenant() - debut;
+         if (crees < threads) {
+            printf("impossible de creer %zu threads\n", threads);
+            break;
+         }
+         printf("%-13s %2zu thread(s) : %8.2f Mops/s\n", variantes[variante],
+                threads, (double) (2 * paires * (nombre / paires)) / duree / 1e6);
+      }
+   }
+
+   detruire(listeVerrouillee.liste);
+   detruireDeque(deque);
+}
+
+void *travaillerForkJoin(void *argument) {
+   TravailForkJoin *travail = (TravailForkJoin *) argument;
+   ForkJoin *forkJoin = travail->forkJoin;
+   DequeVol *deque = forkJoin->deques[travail->numero];
+   size_t victime = travail->numero;
+   while (atomic_load(&forkJoin->restantes)) {
+      Info profondeur;
+      if (supprimerEnQueueVol(deque, &profondeur) != OK) {
+         if (!forkJoin->vol || forkJoin->threads == 1) {
+            continue;
+         }
+         // les victimes sont essayées à tour de rôle
+         victime = (victime + 1) % forkJoin->threads;
+         if (victime == travail->numero ||
+             volerEnTete(forkJoin->deques[victime], &profondeur) != OK) {
+            continue;
+         }
+      }
+      if (profondeur > 0) {
+         Info enfant = profondeur - 1;
+         // le compteur est augmenté avant l'insertion : il ne peut pas tomber
+         // à 0 tant qu'une tache existe
+         atomic_fetch_add(&forkJoin->restantes, 2);
+         insererEnQueueVol(deque, &enfant);
+         insererEnQueueVol(deque, &enfant);
+      } else {
+         unsigned long long valeur = travail->feuilles + 1;
+         for (int i = 0; i < 200; i++) {
+            valeur = valeur * 6364136223846793005u + 1442695040888963407u;
+         }
+         travail->somme += valeur;
+         travail->feuilles++;
+      }
+      atomic_fetch_sub(&forkJoin->restantes, 1);
+   }
+   return NULL;
+}
+
+void benchmarkVolDeTravail(size_t nombre) {
+   enum { THREADS_MAX = 8 };
+   Info profondeur = 0;
+   while (((size_t) 2 << profondeur) <= nombre) {
+      profondeur++;
+   }
+   printf("Fork/join, %zu taches feuilles\n", (size_t) 1 << profondeur);
+   DequeVol *deques[THREADS_MAX] = {NULL};
+   for (size_t i = 0; i < THREADS_MAX; i++) {
+      deques[i] = initialiserDequeVol();
+      if (!deques[i]) {
+         for (size_t j = 0; j < i; j++) {
+            detruireDequeVol(deques[j]);
+         }
+         return;
+      }
+   }
+
+   for (int vol = 0; vol < 2; vol++) {
+      double reference = 0;
+      for (size_t threads = 1; threads <= THREADS_MAX; threads *= 2) {
+         ForkJoin forkJoin = {deques, threads, vol, 1};
+         pthread_t identifiants[THREADS_MAX];
+         TravailForkJoin travaux[THREADS_MAX];
+         for (size_t i = 0; i < threads; i++) {
+            travaux[i] = (TravailForkJoin) {&forkJoin, i, 0, 0};
+         }
+         insererEnQueueVol(deques[0], &profondeur);
+
+         double debut = maintenant();
+         size_t crees = 0;
+         while (crees < threads &&
+                !pthread_create(&identifiants[crees], NULL, travaillerForkJoin,
+                                &travaux[crees])) {
+            crees++;
+         }
+         if (crees < threads) {
+            // les threads crees ne peuvent pas finir sans les autres
+            printf("impossible de creer %zu threads\n", threads);
+            atomic_store(&forkJoin.restantes, 0);
+         }
+         for (size_t i = 0; i < crees; i++) {
+            pthread_join(identifiants[i], NULL);
+         }
+         for (size_t i = 0; crees < threads && i < threads; i++) {
+            while (supprimerEnQueueVol(deques[i], NULL) == OK);
+         }
+         double duree = maintenant() - debut;
+         if (crees < threads) {
+            break;
+         }
+         if (threads == 1) {
+            reference = duree;
+         }
+         size_t minimum = travaux[0].feuilles, maximum = travaux[0].feuilles;
+         for (size_t i = 1; i < threads; i++) {
+            if (travaux[i].feuilles < minimum) {
+               minimum = travaux[i].feuilles;
+            }
+            if (travaux[i].feuilles > maximum) {
+               maximum = travaux[i].feuilles;
+            }
+         }
+         printf("%-8s %zu thread(s) : %8.2f ms  acceleration : %5.2f  "
+                "feuilles par thread : %zu a %zu\n", vol ? "vol" : "sans vol",
+                threads, duree * 1e3, reference / duree, minimum, maximum);
+      }
+   }
+
+   for (size_t i = 0; i < THREADS_MAX; i++) {
+      detruireDequeVol(deques[i]);
+   }
+}
+
+void benchmarkListeIntrusive(size_t nombre) {
+   printf("Liste intrusive, %zu enregistrements\n", nombre);
+   EnregistrementIntrusif *enregistrements =
+      (EnregistrementIntrusif *) malloc(nombre * sizeof(EnregistrementIntrusif));
+   Liste *liste = initialiser();
+   if (!enregistrements || !liste) {
+      free(enregistrements);
+      free(liste);
+      return;
+   }
+   for (size_t i = 0; i < nombre; i++) {
+      enregistrements[i].info = (Info) i;
+   }
+
+   long long somme = 0;
+   double debut = maintenant();
+   for (size_t i = 0; i < nombre; i++) {
+      if (insererEnQueue(liste, &enregistrements[i].info) != OK) {
+         printf("memoire insuffisante\n");
+         break;
+      }
+   }
+   Info info;
+   while (supprimerEnTete(liste, &info) == OK) {
+      somme += info;
+   }
+   double duree = maintenant() - debut;
+   printf("Liste           : %8.2f ms (somme %lld)\n", duree * 1e3, somme);
+
+   ListeIntrusive intrusive;
+   initialiserIntrusive(&intrusive);
+   somme = 0;
+   debut = maintenant();
+   for (size_t i = 0; i < nombre; i++) {
+      insererEnQueueIntrusive(&intrusive, &enregistrements[i].lien);
+   }
+   Maillon *maillon;
+   while (supprimerEnTeteIntrusive(&intrusive, &maillon) == OK) {
+      somme += CONTENEUR(maillon, EnregistrementIntrusif, lien)->info;
+   }
+   duree = maintenant() - debut;
+   printf("ListeIntrusive  : %8.2f ms (somme %lld)\n", duree * 1e3, somme);
+
+   detruire(liste);
+   free(enregistrements);
+}
+
+void benchmarkListeVariable(size_t nombre) {
+   printf("Liste variable, %zu noms de bateaux\n", nombre);
+   // noms générés avant les mesures, les uns à la suite des autres
+   enum { TAILLE_NOM = 32 };
+   char *noms = (char *) malloc(nombre * TAILLE_NOM);
+   ListeChaines *chaines = initialiserListeChaines();
+   ListeVariable *variable = initialiserVariable();
+   if (!noms || !chaines || !variable) {
+      free(noms);
+      free(chaines);
+      free(variable);
+      return;
+   }
+   for (size_t i = 0; i < nombre; i++) {
+      snprintf(&noms[i * TAILLE_NOM], TAILLE_NOM, "Bateau %zu", i);
+   }
+
+   // deux allocations par nom : l'element et la chaîne
+   double debut = maintenant();
+   for (size_t i = 0; i < nombre; i++) {
+      const char *nom = &noms[i * TAILLE_NOM];
+      size_t taille = strlen(nom) + 1;
+      char *copie = (char *) malloc(taille);
+      if (!copie || insererEnQueueListeChaines(chaines, &copie) != OK) {
+         free(copie);
+         printf("memoire insuffisante\n");
+         break;
+      }
+      memcpy(copie, nom, taille);
+   }
+   double construction = maintenant() - debut;
+   size_t longueurs = 0;
+   debut = maintenant();
+   for (const ElementListeChaines *element = premierListeChaines(chaines); element;
+        element = suivantListeChaines(element)) {
+      longueurs += strlen(element->info);
+   }
+   double parcours = maintenant() - debut;
+   debut = maintenant();
+   char *chaine;
+   while (supprimerEnTeteListeChaines(chaines, &chaine) == OK) {
+      free(chaine);
+   }
+   detruireListeChaines(chaines);
+   double destruction = maintenant() - debut;
+   printf("element + chaine : construction %8.2f ms  parcours %8.2f ms  "
+          "destruction %8.2f ms (longueurs %zu)\n", construction * 1e3,
+          parcours * 1e3, destruction * 1e3, longueurs);
+
+   // une allocation par nom : la chaîne est à la fin de l'element
+   debut = maintenant();
+   for (size_t i = 0; i < nombre; i++) {
+      const char *nom = &noms[i * TAILLE_NOM];
+      if (insererEnQueueVariable(variable, nom, strlen(nom) + 1) != OK) {
+         printf("memoire insuffisante\n");
+         break;
+      }
+   }
+   construction = maintenant() - debut;
+   longueurs = 0;
+   debut = maintenant();
+   for (const ElementVariable *element = premierVariable(variable); element;
+        element = suivantVariable(element)) {
+      longueurs += strlen((const char *) element->donnees);
+   }
+   parcours = maintenant() - debut;
+   debut = maintenant();
+   detruireVariable(variable);
+   destruction = maintenant() - debut;
+   printf("ListeVariable    : construction %8.2f ms  parcours %8.2f ms  "
+          "destruction %8.2f ms (longueurs %zu)\n", construction * 1e3,
+          parcours * 1e3, destruction * 1e3, longueurs);
+   free(noms);
+}
+
+#ifndef LISTES_DEROULEES
+void benchmarkReservoir(size_t nombre) {
+   printf("Reservoir d'elements, %zu elements\n", nombre);
+
+   // le reservoir en premier : la memoire gardée par free apres la variante
+   // calloc fausserait sinon sa mesure de RSS
+   ReservoirElements *reservoir = creerReservoir(BENCHMARK_ELEMENTS_PAR_BLOC);
+   Liste *liste = initialiserAvecReservoir(reservoir);
+   libererReservoir(reservoir);
+   if (!liste) {
+      return;
+   }
+   mesurerInsertionSuppression("reservoir", liste, nombre);
+   // second passage : tous les elements sont recyclés depuis la liste des libres
+   mesurerInsertionSuppression("recyclage", liste, nombre);
+   detruire(liste);
+
+   liste = initialiser();
+   if (!liste) {
+      return;
+   }
+   mesurerInsertionSuppression("calloc", liste, nombre);
+   detruire(liste);
+}
+
+void mesurerAccesPositionnel(const char *nom, Liste *liste, size_t nombreAcces) {
+   size_t taille = longueur(liste);
+   size_t position = 0;
+   long long somme = 0;
+
+   double debut = maintenant();
+   for (size_t i = 0; i < nombreAcces; i++) {
+      Info info;
+      // generateur congruentiel : positions réparties sur toute la liste
+      position = (position * 6364136223846793005u + 1442695040888963407u) % taille;
+      if (elementA(liste, position, &info) == OK) {
+         somme += info;
+      }
+   }
+   double acces = maintenant() - debut;
+
+   debut = maintenant();
+   for (size_t i = 1; i <= nombreAcces; i++) {
+      vider(liste, taille - i);
+   }
+   double troncature = maintenant() - debut;
+
+   printf("%-9s elementA : %10.3f us/appel  vider(fin) : %10.3f us/appel  "
+          "(somme %lld)\n", nom, acces / (double) nombreAcces * 1e6,
+          troncature / (double) nombreAcces * 1e6, somme);
+}
+
+void benchmarkIndexPositionnel(size_t nombre) {
+   // le parcours lineaire est en O(n) par appel : peu d'appels suffisent
+   const size_t NOMBRE_ACCES = 1000;
+   printf("Index positionnel, %zu elements\n", nombre);
+   if (nombre <= NOMBRE_ACCES) {
+      return;
+   }
+
+   Liste *liste = initialiser();
+   if (!liste) {
+      return;
+   }
+   for (size_t i = 0; i < nombre; i++) {
+      Info info = (Info) i;
+      if (insererEnQueue(liste, &info) != OK) {
+         detruire(liste);
+         return;
+      }
+   }
+   mesurerAccesPositionnel("lineaire", liste, NOMBRE_ACCES);
+
+   if (activerIndexPositionnel(liste) == OK) {
+      mesurerAccesPositionnel("index", liste, NOMBRE_ACCES);
+   }
+   detruire(liste);
+}
+
+bool horsDe3a7(size_t position, const Info *info) {
+   (void) position; //eviter le warning de parametre non utilise
+   return *info < 3 || *info > 7;
+}
+
+void horsDe3a7ParLot(size_t positionDebut, const Info *infos, size_t nombre,
+                     bool *aSupprimer) {
+   (void) positionDebut; //eviter le warning de parametre non utilise
+   for (size_t i = 0; i < nombre; i++) {
+      aSupprimer[i] = infos[i] < 3 || infos[i] > 7;
+   }
+}
+
+void benchmarkCritereParLot(size_t nombre) {
+   printf("Critere par lot, %zu elements\n", nombre);
+   Liste *l1 = initialiser();
+   Liste *l2 = initialiser();
+   if (!l1 || !l2) {
+      free(l1);
+      free(l2);
+      return;
+   }
+   for (size_t i = 0; i < nombre; i++) {
+      Info info = (Info) (i % 10);
+      if (insererEnQueue(l1, &info) != OK || insererEnQueue(l2, &info) != OK) {
+         detruire(l1);
+         detruire(l2);
+         return;
+      }
+   }
+
+   double debut = maintenant();
+   supprimerSelonCritere(l1, horsDe3a7);
+   double duree = maintenant() - debut;
+   printf("supprimerSelonCritere      : %8.2f ms\n", duree * 1e3);
+
+   debut = maintenant();
+   supprimerSelonCritereParLot(l2, horsDe3a7ParLot);
+   duree = maintenant() - debut;
+   printf("supprimerSelonCritereParLot : %8.2f ms (%s)\n", duree * 1e3,
+          sontEgales(l1, l2) ? "identique" : "DIFFERENT");
+
+   detruire(l1);
+   detruire(l2);
+}
+
+void benchmarkCritereParallele(size_t nombre) {
+   printf("Critere en parallele, %zu elements\n", nombre);
+   // les elements supprimés sont restitués un à un par chaque thread sans
+   // reservoir, accrochés en une fois au reservoir par le thread appelant avec
+   const char *variantes[] = {"calloc", "reservoir"};
+   for (size_t variante = 0; variante < 2; variante++) {
+      double reference = 0;
+      for (size_t threads = 1; threads <= 8; threads *= 2) {
+         Liste *liste = variante ? initialiserAvecReservoir(NULL) : initialiser();
+         if (!liste) {
+            return;
+         }
+         for (size_t i = 0; i < nombre; i++) {
+            Info info = (Info) (i % 10);
+            if (insererEnQueue(liste, &info) != OK) {
+               detruire(liste);
+               return;
+            }
+         }
+         // l'index permet de découper la liste sans la parcourir
+         activerIndexPositionnel(liste);
+
+         double debut = maintenant();
+         supprimerSelonCritereParallele(liste, horsDe3a7, threads);
+         double duree = maintenant() - debut;
+         if (threads == 1) {
+            reference = duree;
+         }
+         printf("%-9s %zu thread(s) : %8.2f ms  acceleration : %5.2f\n",
+                variantes[variante], threads, duree * 1e3, reference / duree);
+         detruire(liste);
+      }
+   }
+}
+
+void benchmarkConstructionParallele(size_t nombre) {
+   printf("Construction en parallele, %zu infos\n", nombre);
+   Info *tableau = (Info *) malloc(nombre * sizeof(Info));
+   if (!tableau) {
+      return;
+   }
+   for (size_t i = 0; i < nombre; i++) {
+      tableau[i] = (Info) i;
+   }
+
+   Liste *liste = initialiser();
+   if (!liste) {
+      free(tableau);
+      return;
+   }
+   double debut = maintenant();
+   for (size_t i = 0; i < nombre && insererEnQueue(liste, &tableau[i]) == OK; i++);
+   double duree = maintenant() - debut;
+   printf("insererEnQueue             : %8.2f ms\n", duree * 1e3);
+   detruire(liste);
+
+   const char *variantes[] = {"vide", "sans reservoir"};
+   for (size_t variante = 0; variante < 2; variante++) {
+      double reference = 0;
+      for (size_t threads = 0; threads <= 8; threads = threads ? threads * 2 : 1) {
+         liste = initialiser();
+         Info info = 0;
+         if (!liste || (variante && insererEnQueue(liste, &info) != OK)) {
+            free(liste);
+            free(tableau);
+            return;
+         }
+         debut = maintenant();
+         // 0 thread : insererTableauEnQueue
+         Status status = threads
+                         ? insererTableauEnQueueParallele(liste, tableau, nombre,
+                                                          threads)
+                         : insererTableauEnQueue(liste, tableau, nombre);
+         duree = maintenant() - debut;
+         if (threads <= 1) {
+            reference = duree;
+         }
+         if (status != OK) {
+            printf("memoire insuffisante\n");
+         } else if (threads) {
+            printf("%-14s %zu thread(s) : %8.2f ms  acceleration : %5.2f\n",
+                   variantes[variante], threads, duree * 1e3, reference / duree);
+         } else {
+            printf("%-14s insererTableauEnQueue : %8.2f ms\n", variantes[variante],
+                   duree * 1e3);
+         }
+         detruire(liste);
+      }
+   }
+   free(tableau);
+}
+
+void benchmarkLecturesParalleles(size_t nombre) {
+   printf("Lectures en parallele, %zu elements\n", nombre);
+   Liste *listes[2] = {initialiser(), initialiser()};
+   for (size_t i = 0; i < nombre && listes[0] && listes[1]; i++) {
+      Info info = (Info) (i % 10);
+      if (insererEnQueue(listes[0], &info) != OK ||
+          insererEnQueue(listes[1], &info) != OK) {
+         break;
+      }
+   }
+   if (!listes[0] || !listes[1] || longueur(listes[1]) != nombre) {
+      printf("memoire insuffisante\n");
+      detruire(listes[0]);
+      detruire(listes[1]);
+      return;
+   }
+
+   const char *variantes[] = {"parcours", "repertoire", "index"};
+   for (size_t variante = 0; variante < 3; variante++) {
+      for (size_t j = 0; j < 2; j++) {
+         if (variante == 1) {
+            activerRepertoireSegments(listes[j], 0);
+         } else if (variante == 2) {
+            desactiverRepertoireSegments(listes[j]);
+            activerIndexPositionnel(listes[j]);
+         }
+      }
+      if (variante == 1) {
+         // le répertoire est construit par le premier traitement parallèle
+         double debut = maintenant();
+         compterSelonCritereParallele(listes[0], horsDe3a7, 2);
+         double duree = maintenant() - debut;
+         compterSelonCritereParallele(listes[1], horsDe3a7, 2);
+         printf("%-10s 1er compter (construction comprise) : %8.2f ms\n",
+                variantes[variante], duree * 1e3);
+      }
+      for (size_t threads = 1; threads <= 8; threads *= 2) {
+         double debut = maintenant();
+         size_t compte = compterSelonCritereParallele(listes[0], horsDe3a7, threads);
+         double dureeCompter = maintenant() - debut;
+
+         debut = maintenant();
+         bool egales = sontEgalesParallele(listes[0], listes[1], threads);
+         double dureeEgales = maintenant() - debut;
+
+         long long somme = 0;
+         const long long neutre = 0;
+         debut = maintenant();
+         replierParallele(listes[0], &somme, &neutre, sizeof(long long),
+                          accumulerSomme, combinerSommes, threads);
+         double dureeReplier = maintenant() - debut;
+
+         printf("%-10s %zu thread(s) : compter %8.2f ms  egales %8.2f ms  "
+                "replier %8.2f ms (%zu, %d, %lld)\n", variantes[variante],
+                threads, dureeCompter * 1e3, dureeEgales * 1e3,
+                dureeReplier * 1e3, compte, egales, somme);
+      }
+   }
+   detruire(listes[0]);
+   detruire(listes[1]);
+}
+
+void accumulerSomme(void *partiel, size_t position, const Info *info) {
+   (void) position; //eviter le warning de parametre non utilise
+   *(long long *) partiel += *info;
+}
+
+void combinerSommes(void *resultat, const void *partiel) {
+   *(long long *) resultat += *(const long long *) partiel;
+}
+
+void benchmarkEmpreinte(size_t nombre) {
+   enum { NOMBRE_LISTES = 100 };
+   const size_t taille = nombre / NOMBRE_LISTES;
+   printf("Empreinte, %d listes de %zu elements\n", NOMBRE_LISTES, taille);
+   Liste *listes[NOMBRE_LISTES] = {NULL};
+   for (size_t i = 0; i < NOMBRE_LISTES; i++) {
+      listes[i] = initialiser();
+      if (!listes[i] || insererTableauEnQueue(listes[i], NULL, taille) != OK) {
+         printf("memoire insuffisante\n");
+         for (size_t j = 0; j <= i; j++) {
+            detruire(listes[j]);
+         }
+         return;
+      }
+      Info info = (Info) i;
+      insererEnQueue(listes[i], &info);
+   }
+
+   for (int avecEmpreinte = 0; avecEmpreinte < 2; avecEmpreinte++) {
+      for (size_t i = 0; avecEmpreinte && i < NOMBRE_LISTES; i++) {
+         activerEmpreinte(listes[i]);
+      }
+      size_t egales = 0;
+      double debut = maintenant();
+      for (size_t i = 0; i < NOMBRE_LISTES; i++) {
+         for (size_t j = i + 1; j < NOMBRE_LISTES; j++) {
+            egales += sontEgales(listes[i], listes[j]);
+         }
+      }
+      double duree = maintenant() - debut;
+      printf("%-14s : %8.2f ms (%zu paires egales)\n",
+             avecEmpreinte ? "avec empreinte" : "sans empreinte", duree * 1e3,
+             egales);
+   }
+
+   for (size_t i = 0; i < NOMBRE_LISTES; i++) {
+      detruire(listes[i]);
+   }
+}
+
+void benchmarkCurseur(size_t nombre) {
+   printf("Curseur, %zu elements\n", nombre);
+   Liste *liste = initialiser();
+   Info *tableau = (Info *) malloc(nombre * sizeof(Info));
+   // au plus une info ajoutée par multiple de 10
+   Info *edite = (Info *) malloc((nombre + nombre / 10 + 1) * sizeof(Info));
+   if (!liste || !tableau || !edite) {
+      free(liste);
+      free(tableau);
+      free(edite);
+      return;
+   }
+   for (size_t i = 0; i < nombre; i++) {
+      tableau[i] = (Info) i;
+   }
+   if (insererTableauEnQueue(liste, tableau, nombre) != OK) {
+      printf("memoire insuffisante\n");
+   }
+
+   double debut = maintenant();
+   size_t copies = versTableau(liste, tableau, nombre);
+   size_t taille = 0;
+   for (size_t i = 0; i < copies; i++) {
+      if (tableau[i] % 3) {
+         edite[taille++] = tableau[i];
+      }
+      if (tableau[i] % 10 == 0) {
+         edite[taille++] = -tableau[i];
+      }
+   }
+   Liste *reconstruite = initialiser();
+   if (!reconstruite || insererTableauEnQueue(reconstruite, edite, taille) != OK) {
+      printf("memoire insuffisante\n");
+   }
+   double duree = maintenant() - debut;
+   printf("reconstruction : %8.2f ms\n", duree * 1e3);
+
+   debut = maintenant();
+   Curseur curseur = curseurEnTete(liste);
+   while (estDansListe(&curseur)) {
+      Info info = curseur.element->info;
+      if (info % 10 == 0) {
+         Info oppose = -info;
+         insererApresCurseur(&curseur, &oppose);
+      }
+      if (info % 3) {
+         avancerCurseur(&curseur);
+      } else {
+         supprimerCurseur(&curseur, NULL);
+      }
+      if (info % 10 == 0) {
+         avancerCurseur(&curseur);
+      }
+   }
+   duree = maintenant() - debut;
+   printf("curseur        : %8.2f ms (%s)\n", duree * 1e3,
+          reconstruite && sontEgales(liste, reconstruite) ? "identique" : "DIFFERENT");
+
+   detruire(liste);
+   detruire(reconstruite);
+   free(tableau);
+   free(edite);
+}
+
+int comparerInfos(const void *a, const void *b) {
+   Info infoA = *(const Info *) a;
+   Info infoB = *(const Info *) b;
+   return (infoA > infoB) - (infoA < infoB);
+}
+
+void benchmarkTri(size_t nombre) {
+   printf("Tri, %zu elements\n", nombre);
+   Info *tableau = (Info *) malloc(nombre * sizeof(Info));
+   Liste *l1 = initialiser();
+   Liste *l2 = initialiser();
+   if (!tableau || !l1 || !l2) {
+      free(tableau);
+      free(l1);
+      free(l2);
+      return;
+   }
+   unsigned graine = 12345;
+   for (size_t i = 0; i < nombre; i++) {
+      graine = graine * 1103515245u + 12345u;
+      tableau[i] = (Info) (graine >> 1);
+   }
+   if (insererTableauEnQueue(l1, tableau, nombre) != OK ||
+       insererTableauEnQueue(l2, tableau, nombre) != OK) {
+      printf("memoire insuffisante\n");
+      detruire(l1);
+      detruire(l2);
+      free(tableau);
+      return;
+   }
+
+   double debut = maintenant();
+   size_t copies = versTableau(l1, tableau, nombre);
+   qsort(tableau, copies, sizeof(Info), comparerInfos);
+   // les elements sont réécrits dans l'ordre : la liste n'est pas reconstruite
+   size_t i = 0;
+   for (Element *element = l1->tete; element; element = element->suivant) {
+      element->info = tableau[i++];
+   }
+   double duree = maintenant() - debut;
+   printf("versTableau + qsort : %8.2f ms\n", duree * 1e3);
+
+   debut = maintenant();
+   trier(l2, NULL);
+   duree = maintenant() - debut;
+   printf("trier               : %8.2f ms (%s)\n", duree * 1e3,
+          sontEgales(l1, l2) ? "identique" : "DIFFERENT");
+
+   debut = maintenant();
+   trier(l2, NULL);
+   duree = maintenant() - debut;
+   printf("trier (deja triee)  : %8.2f ms\n", duree * 1e3);
+
+   detruire(l1);
+   detruire(l2);
+   free(tableau);
+}
+
+Liste *construireSansReservoir(size_t nombre) {
+   Liste *liste = initialiser();
+   if (!liste) {
+      return NULL;
+   }
+   for (Info i = 0; (size_t) i < nombre; i++) {
+      if (insererEnQueue(liste, &i) != OK) {
+         detruire(liste);
+         return NULL;
+      }
+   }
+   return liste;
+}
+
+void benchmarkRestitutionDifferee(size_t nombre) {
+   printf("Restitution differee, vider(0) sans reservoir, %zu elements\n", nombre);
+   Liste *liste = construireSansReservoir(nombre);
+   if (!liste) {
+      printf("memoire insuffisante\n");
+      return;
+   }
+   double debut = maintenant();
+   vider(liste, 0);
+   double duree = maintenant() - debut;
+   printf("immediate    : vider %10.3f ms\n", duree * 1e3);
+   detruire(liste);
+
+   for (int enArrierePlan = 1; enArrierePlan >= 0; enArrierePlan--) {
+      liste = construireSansReservoir(nombre);
+      if (!liste || activerRestitutionDifferee(enArrierePlan) != OK) {
+         printf("memoire insuffisante\n");
+         if (liste) {
+            detruire(liste);
+         }
+         return;
+      }
+      debut = maintenant();
+      vider(liste, 0);
+      duree = maintenant() - debut;
+
+      // par l'appelant : tranches de 4096 elements, comme entre deux requêtes
+      double debutRestitution = maintenant();
+      size_t tranches = 0;
+      if (!enArrierePlan) {
+         while (restituerElementsDifferes(4096)) {
+            tranches++;
+         }
+      }
+      attendreRestitutionsDifferees();
+      double restitution = maintenant() - debutRestitution;
+      if (enArrierePlan) {
+         printf("arriere-plan : vider %10.3f ms, attente restitution %10.3f ms\n",
+                duree * 1e3, restitution * 1e3);
+      } else {
+         printf("par tranches : vider %10.3f ms, %zu tranches en %10.3f ms "
+                "(%.3f ms/tranche)\n", duree * 1e3, tranches, restitution * 1e3,
+                tranches ? restitution * 1e3 / (double) tranches : 0.0);
+      }
+      desactiverRestitutionDifferee();
+      detruire(liste);
+   }
+}
+
+void mesurerParcoursFragmente(const char *nom, const Liste *liste,
+                              const Liste *copie) {
+   long long somme = 0;
+   double debut = maintenant();
+   for (const Element *element = liste->tete; element; element = element->suivant) {
+      somme += element->info;
+   }
+   double parcours = maintenant() - debut;
+
+   debut = maintenant();
+   bool egales = sontEgales(liste, copie);
+   double comparaison = maintenant() - debut;
+   printf("%-10s parcours : %8.2f ms  sontEgales : %8.2f ms (%s, somme %lld)\n",
+          nom, parcours * 1e3, comparaison * 1e3, egales ? "egales" : "DIFFERENTES",
+          somme);
+}
+
+void benchmarkCompactage(size_t nombre) {
+   printf("Compactage, %zu elements\n", nombre);
+   Liste *liste = initialiser();
+   Liste *bruit = initialiser();
+   if (!liste || !bruit) {
+      free(liste);
+      free(bruit);
+      return;
+   }
+
+   // brassage : la liste et une liste de bruit grandissent et rétrécissent par
+   // les deux bouts dans un ordre pseudo-aléatoire ; les elements restitués
+   // sont réutilisés par l'une ou l'autre, dispersant chacune dans le tas
+   unsigned graine = 42;
+   Info info = 0;
+   Status status = OK;
+   for (size_t i = 0; status == OK && i < 8 * nombre; i++) {
+      graine = graine * 1103515245u + 12345u;
+      unsigned tirage = graine >> 16;
+      Liste *cible = tirage & 1 ? liste : bruit;
+      bool enTete = tirage & 2;
+      // les insertions l'emportent tant que la liste n'a pas nombre elements
+      bool inserer = (tirage >> 2) % 8 < (longueur(cible) < nombre ? 5u : 3u);
+      if (inserer) {
+         info = (Info) (tirage >> 4);
+         status = enTete ? insererEnTete(cible, &info) : insererEnQueue(cible, &info);
+      } else if (enTete) {
+         supprimerEnTete(cible, NULL);
+      } else {
+         supprimerEnQueue(cible, NULL);
+      }
+   }
+   detruire(bruit);
+
+   size_t taille = longueur(liste);
+   Info *tableau = (Info *) malloc(taille * sizeof(Info));
+   Liste *copie = initialiser();
+   if (status != OK || !tableau || !copie ||
+       insererTableauEnQueue(copie, tableau, versTableau(liste, tableau, taille)) != OK) {
+      printf("memoire insuffisante\n");
+      free(tableau);
+      detruire(liste);
+      if (copie) {
+         detruire(copie);
+      }
+      return;
+   }
+   free(tableau);
+   printf("%zu elements apres brassage\n", taille);
+
+   mesurerParcoursFragmente("fragmentee", liste, copie);
+   double debut = maintenant();
+   status = compacter(liste);
+   double duree = maintenant() - debut;
+   printf("compacter : %8.2f ms (%s)\n", duree * 1e3,
+          status == OK ? "OK" : "memoire insuffisante");
+   mesurerParcoursFragmente("compactee", liste, copie);
+
+   detruire(liste);
+   detruire(copie);
+}
+
+void *modifierListePropre(void *argument) {
+   size_t insertions = *(size_t *) argument;
+   Liste *liste = initialiser();
+   if (!liste) {
+      return NULL;
+   }
+   unsigned graine = 12345;
+   for (size_t fait = 0; fait < insertions; fait += 256) {
+      for (Info i = 0; i < 256; i++) {
+         graine = graine * 1103515245u + 12345u;
+         if (graine & 0x10000 ? insererEnTete(liste, &i) : insererEnQueue(liste, &i)) {
+            break;
+         }
+      }
+      for (size_t i = 0; i < 256; i++) {
+         graine = graine * 1103515245u + 12345u;
+         if (graine & 0x10000) {
+            supprimerEnTete(liste, NULL);
+         } else {
+            supprimerEnQueue(liste, NULL);
+         }
+      }
+   }
+   detruire(liste);
+   return NULL;
+}
+
+void benchmarkCachesElements(size_t nombre) {
+   enum { THREADS_MAX = 32 };
+   printf("Caches d'elements, %zu insertions et suppressions\n", nombre);
+   for (int avecCaches = 0; avecCaches < 2; avecCaches++) {
+      if (avecCaches) {
+         activerCachesElements();
+      } else {
+         desactiverCachesElements();
+      }
+      printf("%s :", avecCaches ? "caches " : "calloc ");
+      for (size_t threads = 1; threads <= THREADS_MAX; threads *= 2) {
+         size_t insertions = nombre / threads;
+         pthread_t identifiants[THREADS_MAX];
+         double debut = maintenant();
+         size_t crees = 0;
+         while (crees < threads &&
+                !pthread_create(&identifiants[crees], NULL, modifierListePropre,
+                                &insertions)) {
+            crees++;
+         }
+         for (size_t i = 0; i < crees; i++) {
+            pthread_join(identifiants[i], NULL);
+         }
+         double duree = maintenant() - debut;
+         if (crees < threads) {
+            printf(" impossible de creer %zu threads", threads);
+            break;
+         }
+         printf(" %zu th %8.2f ms |", threads, duree * 1e3);
+      }
+      printf("\n");
+   }
+   desactiverCachesElements();
+}
+#endif
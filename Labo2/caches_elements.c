@@ -0,0 +1,253 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : caches_elements.c
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Ce fichier implémente les caches d'éléments par thread utilisés
+                  par les listes sans réservoir (cf. activerCachesElements dans
+                  listes_dynamiques.h).
+
+ Remarque(s)    : Chaque thread garde les éléments qu'il restitue dans une liste
+                  des libres qui lui est propre, sans verrou. Au-delà de
+                  2 * ELEMENTS_PAR_LOT éléments, un lot de ELEMENTS_PAR_LOT
+                  éléments est rendu à une réserve commune (protégée par un
+                  verrou), dans laquelle un thread dont le cache est vide reprend
+                  un lot entier. Les éléments en cache ont tous été alloués un à
+                  un par calloc : chacun peut être restitué par free.
+                  Les caches sont inactifs tant que activerCachesElements n'a
+                  pas été appelée ; le cache du thread qui termine le programme
+                  et la réserve sont alors restitués à la sortie (atexit).
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+#include "listes_dynamiques_internal.h"
+#include "instrumentation_internal.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+// Nombre d'elements échangés à la fois entre un cache et la réserve commune
+#define ELEMENTS_PAR_LOT 64
+
+// Nombre maximal de lots gardés par la réserve commune ; les lots suivants sont
+// restitués par free
+#define LOTS_MAX_RESERVE 256
+
+typedef struct {
+   Element *libres;              // chaînés via suivant
+   size_t nombre;
+   bool enregistre;              // restitution à la fin du thread prévue
+} CacheThread;
+
+// Lots de la réserve : les elements d'un lot sont chaînés via suivant, le
+// premier element de chaque lot pointe le lot suivant via precedent
+static struct {
+   pthread_mutex_t verrou;
+   Element *lots;
+   atomic_size_t nombreLots;     // lu sans verrou pour éviter de le prendre
+} reserve = {
+   .verrou = PTHREAD_MUTEX_INITIALIZER
+};
+
+static _Thread_local CacheThread cache;
+
+// false par défaut : les caches sont inactifs
+static atomic_bool cachesActifs;
+
+static pthread_once_t creationCle = PTHREAD_ONCE_INIT;
+static pthread_key_t cleCache;
+
+static pthread_once_t enregistrementSortie = PTHREAD_ONCE_INIT;
+
+/**
+ * Crée la clé dont le destructeur restitue le cache d'un thread qui se termine
+ */
+static void creerCleCache(void);
+
+/**
+ * Prévoit la restitution, à la sortie du programme, du cache du thread qui le
+ * termine et de la réserve commune
+ */
+static void enregistrerRestitutionFinale(void);
+
+/**
+ * Prévoit la restitution du cache du thread appelant à la fin de celui-ci, si
+ * ce n'est pas déjà fait
+ */
+static void enregistrerCache(void);
+
+/**
+ * Destructeur de cleCache : rend les elements du cache d'un thread qui se
+ * termine à la réserve commune (dans la limite de LOTS_MAX_RESERVE lots) et
+ * restitue les autres
+ * @param argument le CacheThread du thread
+ */
+static void terminerCache(void *argument);
+
+/**
+ * Détache les nombre premiers elements du cache
+ * @param cacheThread
+ * @param nombre au plus cacheThread->nombre
+ * @return le premier element de la chaîne détachée (terminée par NULL)
+ */
+static Element *detacherLot(CacheThread *cacheThread, size_t nombre);
+
+/**
+ * Ajoute lot à la réserve commune si elle n'est pas pleine
+ * @param lot chaîne de ELEMENTS_PAR_LOT elements
+ * @return true si le lot a été ajouté, false s'il reste à restituer
+ */
+static bool deposerLot(Element *lot);
+
+/**
+ * Restitue par free les elements de la chaîne debut -> ... -> NULL
+ * @param debut
+ */
+static void restituerLot(Element *debut);
+
+void creerCleCache(void) {
+   pthread_key_create(&cleCache, terminerCache);
+}
+
+void enregistrerRestitutionFinale(void) {
+   atexit(restituerCachesElements);
+}
+
+void enregistrerCache(void) {
+   if (!cache.enregistre) {
+      pthread_once(&creationCle, creerCleCache);
+      pthread_setspecific(cleCache, &cache);
+      cache.enregistre = true;
+   }
+}
+
+void terminerCache(void *argument) {
+   CacheThread *cacheThread = (CacheThread *) argument;
+   // caches désactivés depuis : rien n'est gardé dans la réserve
+   while (atomic_load(&cachesActifs) && cacheThread->nombre >= ELEMENTS_PAR_LOT) {
+      Element *lot = detacherLot(cacheThread, ELEMENTS_PAR_LOT);
+      if (!deposerLot(lot)) {
+         restituerLot(lot);
+      }
+   }
+   restituerLot(detacherLot(cacheThread, cacheThread->nombre));
+}
+
+Element *detacherLot(CacheThread *cacheThread, size_t nombre) {
+   if (!nombre) {
+      return NULL;
+   }
+   Element *lot = cacheThread->libres;
+   Element *dernier = lot;
+   for (size_t i = 1; i < nombre; i++) {
+      dernier = dernier->suivant;
+   }
+   cacheThread->libres = dernier->suivant;
+   cacheThread->nombre -= nombre;
+   dernier->suivant = NULL;
+   return lot;
+}
+
+bool deposerLot(Element *lot) {
+   bool depose = false;
+   pthread_mutex_lock(&reserve.verrou);
+   if (atomic_load_explicit(&reserve.nombreLots, memory_order_relaxed) <
+       LOTS_MAX_RESERVE) {
+      lot->precedent = reserve.lots;
+      reserve.lots = lot;
+      atomic_fetch_add_explicit(&reserve.nombreLots, 1, memory_order_relaxed);
+      depose = true;
+   }
+   pthread_mutex_unlock(&reserve.verrou);
+   return depose;
+}
+
+void restituerLot(Element *debut) {
+   while (debut) {
+      Element *tmp = debut;
+      debut = debut->suivant;
+      free(tmp);
+      COMPTER_RESTITUTIONS(0, 1);
+   }
+}
+
+Element *allouerElementSansReservoir(void) {
+   if (!cache.libres &&
+       atomic_load_explicit(&reserve.nombreLots, memory_order_relaxed) &&
+       atomic_load_explicit(&cachesActifs, memory_order_relaxed)) {
+      // cache vide : on reprend un lot entier de la réserve
+      pthread_mutex_lock(&reserve.verrou);
+      Element *lot = reserve.lots;
+      if (lot) {
+         reserve.lots = lot->precedent;
+         atomic_fetch_sub_explicit(&reserve.nombreLots, 1, memory_order_relaxed);
+         cache.libres = lot;
+         cache.nombre = ELEMENTS_PAR_LOT;
+      }
+      pthread_mutex_unlock(&reserve.verrou);
+      if (lot) {
+         // le reste du lot sera rendu à la réserve à la fin du thread, même
+         // s'il ne restitue aucun element
+         enregistrerCache();
+      }
+   }
+
+   Element *element = cache.libres;
+   if (element) {
+      cache.libres = element->suivant;
+      cache.nombre--;
+      COMPTER_ALLOCATIONS(1, 0);
+      // meme garantie que calloc
+      *element = (Element) {0};
+      return element;
+   }
+   COMPTER_ALLOCATIONS(1, 1);
+   // On utilise calloc pour avoir tous les elements de Element à 0
+   return (Element *) calloc(1, sizeof(Element));
+}
+
+void libererElementSansReservoir(Element *element) {
+   if (!atomic_load_explicit(&cachesActifs, memory_order_relaxed)) {
+      free(element);
+      COMPTER_RESTITUTIONS(0, 1);
+      return;
+   }
+   // le cache sera rendu à la réserve à la fin du thread
+   enregistrerCache();
+   element->suivant = cache.libres;
+   cache.libres = element;
+   if (++cache.nombre >= 2 * ELEMENTS_PAR_LOT) {
+      // on garde de quoi alterner insertions et suppressions sans passer par la
+      // réserve
+      Element *lot = detacherLot(&cache, ELEMENTS_PAR_LOT);
+      if (!deposerLot(lot)) {
+         restituerLot(lot);
+      }
+   }
+}
+
+void activerCachesElements(void) {
+   pthread_once(&enregistrementSortie, enregistrerRestitutionFinale);
+   atomic_store(&cachesActifs, true);
+}
+
+void desactiverCachesElements(void) {
+   atomic_store(&cachesActifs, false);
+   restituerCachesElements();
+}
+
+void restituerCachesElements(void) {
+   restituerLot(detacherLot(&cache, cache.nombre));
+   pthread_mutex_lock(&reserve.verrou);
+   Element *lots = reserve.lots;
+   reserve.lots = NULL;
+   atomic_store_explicit(&reserve.nombreLots, 0, memory_order_relaxed);
+   pthread_mutex_unlock(&reserve.verrou);
+   while (lots) {
+      Element *lot = lots;
+      lots = lot->precedent;
+      restituerLot(lot);
+   }
+}
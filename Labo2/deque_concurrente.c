@@ -0,0 +1,280 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : deque_concurrente.c
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Ce fichier implémente la deque concurrente (deque_concurrente.h)
+                  sous forme de liste doublement chaînée protégée par un verrou
+                  par extrémité.
+
+ Remarque(s)    : Les verrous sont toujours pris dans l'ordre tête puis queue.
+                  Une opération ne prend que le verrou de son extrémité si la
+                  deque contient plus de SEUIL_DEUX_VERROUS éléments : chaque
+                  extrémité n'a qu'une opération en cours à la fois, et une
+                  opération à l'autre extrémité ne peut alors modifier que
+                  d'autres champs des éléments voisins.
+                  Les éléments sont alloués et restitués hors des verrous.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+#include "deque_concurrente.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+// Taille supposée d'une ligne de cache
+#define TAILLE_LIGNE_CACHE 64
+
+typedef struct noeudDeque {
+   Info info;
+   struct noeudDeque *suivant;
+   struct noeudDeque *precedent;
+} NoeudDeque;
+
+// Extrémités de la deque
+typedef enum {
+   TETE, QUEUE
+} Extremite;
+
+struct dequeConcurrente {
+   pthread_mutex_t verrouTete;
+   NoeudDeque *tete;
+   pthread_cond_t nonVide;       // attendue avec verrouTete
+   atomic_size_t enAttente;      // threads en attente sur nonVide
+   // les données de chaque extrémité sont sur des lignes de cache distinctes
+   char separation[TAILLE_LIGNE_CACHE];
+   pthread_mutex_t verrouQueue;
+   NoeudDeque *queue;
+   char separationTaille[TAILLE_LIGNE_CACHE];
+   atomic_size_t taille;
+};
+
+/**
+ * Verrouille l'extremité extremite de deque, ainsi que l'autre extremité si
+ * deque ne contient pas plus de SEUIL_DEUX_VERROUS elements
+ * @param deque
+ * @param extremite extremité à laquelle l'opération a lieu
+ * @return true si les deux verrous ont été pris, false sinon
+ */
+static bool verrouiller(DequeConcurrente *deque, Extremite extremite);
+
+/**
+ * Libère les verrous pris par verrouiller
+ * @param deque
+ * @param extremite extremité passée à verrouiller
+ * @param deux valeur renvoyée par verrouiller
+ */
+static void deverrouiller(DequeConcurrente *deque, Extremite extremite, bool deux);
+
+/**
+ * Insère un nouvel element contenant info à l'extremité extremite de deque
+ * @param deque
+ * @param info info à insérer (0 si NULL)
+ * @param extremite
+ * @return OK ou MEMOIRE_INSUFFISANTE
+ */
+static Status inserer(DequeConcurrente *deque, const Info *info,
+                      Extremite extremite);
+
+/**
+ * Supprime l'element à l'extremité extremite de deque et renvoie son info
+ * @param deque
+ * @param info pour retourner l'info supprimée (peut être NULL)
+ * @param extremite
+ * @param bloquant true pour attendre qu'un element soit inséré si deque est vide
+ * @return OK ou LISTE_VIDE (seulement si bloquant vaut false)
+ */
+static Status supprimer(DequeConcurrente *deque, Info *info, Extremite extremite,
+                        bool bloquant);
+
+DequeConcurrente *initialiserDeque(void) {
+   DequeConcurrente *deque = (DequeConcurrente *) calloc(1, sizeof(DequeConcurrente));
+   if (!deque) {
+      return NULL;
+   }
+   if (pthread_mutex_init(&deque->verrouTete, NULL)) {
+      free(deque);
+      return NULL;
+   }
+   if (pthread_mutex_init(&deque->verrouQueue, NULL)) {
+      pthread_mutex_destroy(&deque->verrouTete);
+      free(deque);
+      return NULL;
+   }
+   if (pthread_cond_init(&deque->nonVide, NULL)) {
+      pthread_mutex_destroy(&deque->verrouQueue);
+      pthread_mutex_destroy(&deque->verrouTete);
+      free(deque);
+      return NULL;
+   }
+   atomic_init(&deque->taille, 0);
+   atomic_init(&deque->enAttente, 0);
+   return deque;
+}
+
+size_t longueurDeque(const DequeConcurrente *deque) {
+   return atomic_load(&deque->taille);
+}
+
+bool verrouiller(DequeConcurrente *deque, Extremite extremite) {
+   if (extremite == TETE) {
+      pthread_mutex_lock(&deque->verrouTete);
+      if (atomic_load(&deque->taille) > SEUIL_DEUX_VERROUS) {
+         return false;
+      }
+      pthread_mutex_lock(&deque->verrouQueue);
+      return true;
+   }
+
+   pthread_mutex_lock(&deque->verrouQueue);
+   if (atomic_load(&deque->taille) > SEUIL_DEUX_VERROUS) {
+      return false;
+   }
+   // le verrou de tete doit être pris en premier
+   pthread_mutex_unlock(&deque->verrouQueue);
+   pthread_mutex_lock(&deque->verrouTete);
+   pthread_mutex_lock(&deque->verrouQueue);
+   return true;
+}
+
+void deverrouiller(DequeConcurrente *deque, Extremite extremite, bool deux) {
+   if (deux || extremite == QUEUE) {
+      pthread_mutex_unlock(&deque->verrouQueue);
+   }
+   if (deux || extremite == TETE) {
+      pthread_mutex_unlock(&deque->verrouTete);
+   }
+}
+
+Status inserer(DequeConcurrente *deque, const Info *info, Extremite extremite) {
+   NoeudDeque *noeud = (NoeudDeque *) malloc(sizeof(NoeudDeque));
+   if (!noeud) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+   noeud->info = info ? *info : 0;
+
+   bool deux = verrouiller(deque, extremite);
+   // une deque vide implique les deux verrous : l'autre extremité peut alors
+   // être modifiée
+   if (extremite == TETE) {
+      noeud->precedent = NULL;
+      noeud->suivant = deque->tete;
+      if (deque->tete) {
+         deque->tete->precedent = noeud;
+      } else {
+         deque->queue = noeud;
+      }
+      deque->tete = noeud;
+   } else {
+      noeud->suivant = NULL;
+      noeud->precedent = deque->queue;
+      if (deque->queue) {
+         deque->queue->suivant = noeud;
+      } else {
+         deque->tete = noeud;
+      }
+      deque->queue = noeud;
+   }
+   atomic_fetch_add(&deque->taille, 1);
+   deverrouiller(deque, extremite, deux);
+
+   // un thread ne commence à attendre que si la deque est vide, donc en tenant
+   // verrouTete avant toute insertion : il ne peut pas manquer ce signal
+   if (atomic_load(&deque->enAttente)) {
+      pthread_cond_signal(&deque->nonVide);
+   }
+   return OK;
+}
+
+Status supprimer(DequeConcurrente *deque, Info *info, Extremite extremite,
+                 bool bloquant) {
+   bool deux;
+   if (bloquant) {
+      pthread_mutex_lock(&deque->verrouTete);
+      atomic_fetch_add(&deque->enAttente, 1);
+      while (!atomic_load(&deque->taille)) {
+         pthread_cond_wait(&deque->nonVide, &deque->verrouTete);
+      }
+      atomic_fetch_sub(&deque->enAttente, 1);
+      // verrouTete est déjà pris : seul celui de la queue peut manquer
+      deux = extremite == QUEUE ||
+             atomic_load(&deque->taille) <= SEUIL_DEUX_VERROUS;
+      if (deux) {
+         pthread_mutex_lock(&deque->verrouQueue);
+      }
+   } else {
+      deux = verrouiller(deque, extremite);
+      if (!atomic_load(&deque->taille)) {
+         deverrouiller(deque, extremite, deux);
+         return LISTE_VIDE;
+      }
+   }
+
+   NoeudDeque *noeud;
+   if (extremite == TETE) {
+      noeud = deque->tete;
+      deque->tete = noeud->suivant;
+      if (deque->tete) {
+         deque->tete->precedent = NULL;
+      } else {
+         deque->queue = NULL;
+      }
+   } else {
+      noeud = deque->queue;
+      deque->queue = noeud->precedent;
+      if (deque->queue) {
+         deque->queue->suivant = NULL;
+      } else {
+         deque->tete = NULL;
+      }
+   }
+   atomic_fetch_sub(&deque->taille, 1);
+   deverrouiller(deque, extremite, deux);
+
+   if (info) {
+      *info = noeud->info;
+   }
+   free(noeud);
+   return OK;
+}
+
+Status insererEnTeteDeque(DequeConcurrente *deque, const Info *info) {
+   return inserer(deque, info, TETE);
+}
+
+Status insererEnQueueDeque(DequeConcurrente *deque, const Info *info) {
+   return inserer(deque, info, QUEUE);
+}
+
+Status supprimerEnTeteDeque(DequeConcurrente *deque, Info *info) {
+   return supprimer(deque, info, TETE, false);
+}
+
+Status supprimerEnQueueDeque(DequeConcurrente *deque, Info *info) {
+   return supprimer(deque, info, QUEUE, false);
+}
+
+Status supprimerEnTeteDequeBloquant(DequeConcurrente *deque, Info *info) {
+   return supprimer(deque, info, TETE, true);
+}
+
+Status supprimerEnQueueDequeBloquant(DequeConcurrente *deque, Info *info) {
+   return supprimer(deque, info, QUEUE, true);
+}
+
+void detruireDeque(DequeConcurrente *deque) {
+   if (!deque) {
+      return;
+   }
+   while (deque->tete) {
+      NoeudDeque *noeud = deque->tete;
+      deque->tete = noeud->suivant;
+      free(noeud);
+   }
+   pthread_cond_destroy(&deque->nonVide);
+   pthread_mutex_destroy(&deque->verrouQueue);
+   pthread_mutex_destroy(&deque->verrouTete);
+   free(deque);
+}
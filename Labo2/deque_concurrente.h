@@ -0,0 +1,95 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : deque_concurrente.h
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : File à double entrée (deque) utilisable simultanément par
+                  plusieurs threads, offrant les opérations d'insertion et de
+                  suppression en tête et en queue de listes_dynamiques.h
+
+ Remarque(s)    : Chaque extrémité a son propre verrou : des threads travaillant
+                  à des extrémités opposées (producteurs en queue, consommateurs
+                  en tête) ne se bloquent pas mutuellement tant que la deque
+                  contient plus de SEUIL_DEUX_VERROUS éléments.
+                  Disponible avec les deux représentations de liste.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+
+#ifndef DEQUE_CONCURRENTE_H
+#define DEQUE_CONCURRENTE_H
+
+#include "listes_dynamiques.h"
+
+// Jusqu'à ce nombre d'éléments, les deux extrémités peuvent toucher les mêmes
+// éléments : une opération prend alors les deux verrous.
+#define SEUIL_DEUX_VERROUS 2
+
+typedef struct dequeConcurrente DequeConcurrente;
+
+// ------------------------------------------------------------------------------
+// Initialisation d'une deque vide.
+// Renvoie NULL en cas de mémoire insuffisante (ou si les verrous n'ont pas pu
+// être créés)
+DequeConcurrente *initialiserDeque(void);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie le nombre d'éléments de deque.
+// N.B. La valeur peut être dépassée dès son retour si d'autres threads utilisent
+// deque.
+size_t longueurDeque(const DequeConcurrente *deque);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Insère un nouvel élément (contenant info) en tête de deque.
+// Renvoie OK si l'insertion s'est déroulée avec succès et MEMOIRE_INSUFFISANTE
+// s'il n'y a pas assez de mémoire pour créer le nouvel élément.
+Status insererEnTeteDeque(DequeConcurrente *deque, const Info *info);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Insère un nouvel élément (contenant info) en queue de deque.
+// Renvoie OK si l'insertion s'est déroulée avec succès et MEMOIRE_INSUFFISANTE
+// s'il n'y a pas assez de mémoire pour créer le nouvel élément.
+Status insererEnQueueDeque(DequeConcurrente *deque, const Info *info);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie, via le paramètre info, l'info stockée dans l'élément en tête de deque,
+// puis supprime, en restituant la mémoire allouée, ledit élément.
+// Renvoie LISTE_VIDE si deque est vide, OK sinon.
+Status supprimerEnTeteDeque(DequeConcurrente *deque, Info *info);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie, via le paramètre info, l'info stockée dans l'élément en queue de deque,
+// puis supprime, en restituant la mémoire allouée, ledit élément.
+// Renvoie LISTE_VIDE si deque est vide, OK sinon.
+Status supprimerEnQueueDeque(DequeConcurrente *deque, Info *info);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Comme supprimerEnTeteDeque, mais si deque est vide, attend qu'un autre thread
+// y insère un élément.
+// Renvoie OK.
+Status supprimerEnTeteDequeBloquant(DequeConcurrente *deque, Info *info);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Comme supprimerEnQueueDeque, mais si deque est vide, attend qu'un autre thread
+// y insère un élément.
+// Renvoie OK.
+Status supprimerEnQueueDequeBloquant(DequeConcurrente *deque, Info *info);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Supprime, en restituant la mémoire allouée, tous les éléments de deque puis
+// restitue deque elle-même.
+// N.B. Aucun thread ne doit plus utiliser (ni attendre sur) deque.
+void detruireDeque(DequeConcurrente *deque);
+// ------------------------------------------------------------------------------
+
+#endif
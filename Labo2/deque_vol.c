@@ -0,0 +1,202 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : deque_vol.c
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Ce fichier implémente la deque de vol de travail
+                  (deque_vol.h) selon l'algorithme de Chase et Lev, avec les
+                  ordres mémoire C11 de Lê, Pop, Cohen et Zappa Nardelli
+                  ("Correct and Efficient Work-Stealing for Weak Memory Models",
+                  2013).
+
+ Remarque(s)    : tete et queue sont des compteurs qui ne font que croître
+                  (hormis la décrémentation temporaire de queue par
+                  supprimerEnQueueVol) ; l'info d'indice i se trouve dans la case
+                  i & (capacite - 1) du tableau.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+#include "deque_vol.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+
+// Capacité (puissance de 2) du premier tableau d'une deque
+#define CAPACITE_INITIALE_VOL 64
+
+// Taille supposée d'une ligne de cache
+#define TAILLE_LIGNE_CACHE 64
+
+/**
+ * Tableau circulaire des infos d'une deque
+ */
+typedef struct tableauVol {
+   struct tableauVol *precedent;   // tableau remplacé, restitué à la destruction
+   long long capacite;             // toujours une puissance de 2
+   _Atomic Info infos[];
+} TableauVol;
+
+struct dequeVol {
+   atomic_llong tete;              // modifiée par les voleurs
+   char separation[TAILLE_LIGNE_CACHE];
+   atomic_llong queue;             // modifiée par le propriétaire seulement
+   _Atomic(TableauVol *) tableau;
+};
+
+/**
+ * Alloue un tableau de capacite infos
+ * @param capacite puissance de 2
+ * @param precedent tableau remplacé par le nouveau (NULL pour le premier)
+ * @return le tableau ou NULL en cas de mémoire insuffisante
+ */
+static TableauVol *creerTableau(long long capacite, TableauVol *precedent);
+
+/**
+ * Remplace le tableau de deque par un tableau deux fois plus grand contenant les
+ * infos d'indices tete à queue - 1
+ * @param deque
+ * @param tete
+ * @param queue
+ * @return le nouveau tableau ou NULL en cas de mémoire insuffisante
+ */
+static TableauVol *agrandir(DequeVol *deque, long long tete, long long queue);
+
+TableauVol *creerTableau(long long capacite, TableauVol *precedent) {
+   TableauVol *tableau = (TableauVol *) malloc(sizeof(TableauVol) +
+                                               (size_t) capacite * sizeof(_Atomic Info));
+   if (tableau) {
+      tableau->precedent = precedent;
+      tableau->capacite = capacite;
+   }
+   return tableau;
+}
+
+DequeVol *initialiserDequeVol(void) {
+   DequeVol *deque = (DequeVol *) calloc(1, sizeof(DequeVol));
+   if (!deque) {
+      return NULL;
+   }
+   TableauVol *tableau = creerTableau(CAPACITE_INITIALE_VOL, NULL);
+   if (!tableau) {
+      free(deque);
+      return NULL;
+   }
+   atomic_init(&deque->tete, 0);
+   atomic_init(&deque->queue, 0);
+   atomic_init(&deque->tableau, tableau);
+   return deque;
+}
+
+size_t longueurDequeVol(const DequeVol *deque) {
+   long long queue = atomic_load_explicit(&deque->queue, memory_order_relaxed);
+   long long tete = atomic_load_explicit(&deque->tete, memory_order_relaxed);
+   return queue > tete ? (size_t) (queue - tete) : 0;
+}
+
+TableauVol *agrandir(DequeVol *deque, long long tete, long long queue) {
+   TableauVol *ancien = atomic_load_explicit(&deque->tableau, memory_order_relaxed);
+   TableauVol *tableau = creerTableau(2 * ancien->capacite, ancien);
+   if (!tableau) {
+      return NULL;
+   }
+   for (long long i = tete; i < queue; i++) {
+      atomic_store_explicit(
+         &tableau->infos[i & (tableau->capacite - 1)],
+         atomic_load_explicit(&ancien->infos[i & (ancien->capacite - 1)],
+                              memory_order_relaxed),
+         memory_order_relaxed);
+   }
+   // un voleur ayant lu l'ancien tableau peut encore le lire : il n'est restitué
+   // qu'à la destruction de la deque
+   atomic_store_explicit(&deque->tableau, tableau, memory_order_release);
+   return tableau;
+}
+
+Status insererEnQueueVol(DequeVol *deque, const Info *info) {
+   long long queue = atomic_load_explicit(&deque->queue, memory_order_relaxed);
+   long long tete = atomic_load_explicit(&deque->tete, memory_order_acquire);
+   TableauVol *tableau = atomic_load_explicit(&deque->tableau, memory_order_relaxed);
+   if (queue - tete > tableau->capacite - 1) {
+      tableau = agrandir(deque, tete, queue);
+      if (!tableau) {
+         return MEMOIRE_INSUFFISANTE;
+      }
+   }
+   atomic_store_explicit(&tableau->infos[queue & (tableau->capacite - 1)],
+                         info ? *info : 0, memory_order_relaxed);
+   // l'info doit être visible avant la nouvelle queue
+   atomic_thread_fence(memory_order_release);
+   atomic_store_explicit(&deque->queue, queue + 1, memory_order_relaxed);
+   return OK;
+}
+
+Status supprimerEnQueueVol(DequeVol *deque, Info *info) {
+   // la queue est décrémentée avant de lire la tete : un voleur qui lit ensuite
+   // la queue ne peut plus prendre cette info
+   long long queue = atomic_load_explicit(&deque->queue, memory_order_relaxed) - 1;
+   TableauVol *tableau = atomic_load_explicit(&deque->tableau, memory_order_relaxed);
+   atomic_store_explicit(&deque->queue, queue, memory_order_relaxed);
+   atomic_thread_fence(memory_order_seq_cst);
+   long long tete = atomic_load_explicit(&deque->tete, memory_order_relaxed);
+
+   Status status = OK;
+   if (tete <= queue) {
+      Info derniere = atomic_load_explicit(&tableau->infos[queue & (tableau->capacite - 1)],
+                                           memory_order_relaxed);
+      if (tete == queue) {
+         // derniere info : on la dispute aux voleurs en avançant la tete
+         if (!atomic_compare_exchange_strong_explicit(&deque->tete, &tete, tete + 1,
+                                                      memory_order_seq_cst,
+                                                      memory_order_relaxed)) {
+            status = LISTE_VIDE;
+         }
+         atomic_store_explicit(&deque->queue, queue + 1, memory_order_relaxed);
+      }
+      if (status == OK && info) {
+         *info = derniere;
+      }
+   } else {
+      // deque vide : on rétablit la queue
+      status = LISTE_VIDE;
+      atomic_store_explicit(&deque->queue, queue + 1, memory_order_relaxed);
+   }
+   return status;
+}
+
+Status volerEnTete(DequeVol *deque, Info *info) {
+   for (;;) {
+      long long tete = atomic_load_explicit(&deque->tete, memory_order_acquire);
+      atomic_thread_fence(memory_order_seq_cst);
+      long long queue = atomic_load_explicit(&deque->queue, memory_order_acquire);
+      if (tete >= queue) {
+         return LISTE_VIDE;
+      }
+
+      TableauVol *tableau = atomic_load_explicit(&deque->tableau, memory_order_acquire);
+      Info premiere = atomic_load_explicit(&tableau->infos[tete & (tableau->capacite - 1)],
+                                           memory_order_relaxed);
+      if (atomic_compare_exchange_strong_explicit(&deque->tete, &tete, tete + 1,
+                                                  memory_order_seq_cst,
+                                                  memory_order_relaxed)) {
+         if (info) {
+            *info = premiere;
+         }
+         return OK;
+      }
+      // un autre voleur (ou le propriétaire) a pris cette info : on recommence
+   }
+}
+
+void detruireDequeVol(DequeVol *deque) {
+   if (!deque) {
+      return;
+   }
+   TableauVol *tableau = atomic_load_explicit(&deque->tableau, memory_order_relaxed);
+   while (tableau) {
+      TableauVol *precedent = tableau->precedent;
+      free(tableau);
+      tableau = precedent;
+   }
+   free(deque);
+}
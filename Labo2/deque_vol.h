@@ -0,0 +1,75 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : deque_vol.h
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Deque de vol de travail (Chase-Lev) : un thread propriétaire
+                  insère et retire des infos en queue sans verrou, et n'importe
+                  quel autre thread peut lui en voler en tête.
+
+ Remarque(s)    : Destinée à la répartition de tâches entre threads : chaque
+                  thread possède sa deque et vole dans celles des autres lorsque
+                  la sienne est vide.
+                  Les infos sont stockées dans un tableau circulaire qui double
+                  de capacité lorsqu'il est plein ; les tableaux remplacés ne sont
+                  restitués que par detruireDequeVol.
+                  Disponible avec les deux représentations de liste.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+
+#ifndef DEQUE_VOL_H
+#define DEQUE_VOL_H
+
+#include "listes_dynamiques.h"
+
+typedef struct dequeVol DequeVol;
+
+// ------------------------------------------------------------------------------
+// Initialisation d'une deque de vol vide.
+// Renvoie NULL en cas de mémoire insuffisante
+DequeVol *initialiserDequeVol(void);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie le nombre d'infos de deque.
+// N.B. Simple estimation si d'autres threads utilisent deque.
+size_t longueurDequeVol(const DequeVol *deque);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Insère info (0 si NULL) en queue de deque.
+// Renvoie OK si l'insertion s'est déroulée avec succès et MEMOIRE_INSUFFISANTE
+// si le tableau de deque n'a pas pu être agrandi.
+// N.B. Réservé au thread propriétaire de deque.
+Status insererEnQueueVol(DequeVol *deque, const Info *info);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie, via le paramètre info, l'info en queue de deque (la dernière
+// insérée) et la retire de deque.
+// Renvoie LISTE_VIDE si deque est vide (ou si sa dernière info vient d'être
+// volée), OK sinon.
+// N.B. Réservé au thread propriétaire de deque.
+Status supprimerEnQueueVol(DequeVol *deque, Info *info);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie, via le paramètre info, l'info en tête de deque (la plus ancienne) et
+// la retire de deque.
+// Renvoie LISTE_VIDE si deque est vide, OK sinon.
+// N.B. Peut être appelée par n'importe quel thread, simultanément à celles du
+// propriétaire. En cas de conflit avec un autre voleur, la tentative est
+// recommencée.
+Status volerEnTete(DequeVol *deque, Info *info);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Restitue deque, ses infos et tous ses tableaux.
+// N.B. Aucun thread ne doit plus utiliser deque.
+void detruireDequeVol(DequeVol *deque);
+// ------------------------------------------------------------------------------
+
+#endif
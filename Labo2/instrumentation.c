@@ -0,0 +1,236 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : instrumentation.c
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Ce fichier implémente les compteurs d'exécution de la librairie
+                  de listes (instrumentation.h).
+
+ Remarque(s)    : Les compteurs sont atomiques, mis à jour sans ordre mémoire
+                  (relaxed) : une lecture pendant des appels en cours peut
+                  mélanger des compteurs d'avant et d'après un appel.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+#include "instrumentation_internal.h"
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+
+#define NOMMER_OPERATION(OPERATION, FONCTION) #FONCTION,
+
+static const char *const NOMS_OPERATIONS[NOMBRE_OPERATIONS] = {
+   OPERATIONS_INSTRUMENTEES(NOMMER_OPERATION)
+};
+
+#ifdef LISTES_INSTRUMENTATION
+
+typedef struct {
+   atomic_size_t appels;
+   atomic_size_t elementsParcourus;
+   atomic_size_t maximumParcourus;
+   atomic_uint_least64_t duree;
+   atomic_size_t latences[CLASSES_LATENCE];
+} CompteursOperation;
+
+static struct {
+   atomic_size_t elementsAlloues;
+   atomic_size_t elementsRestitues;
+   atomic_size_t allocationsSysteme;
+   atomic_size_t liberationsSysteme;
+   CompteursOperation operations[NOMBRE_OPERATIONS];
+} compteurs;
+
+_Thread_local size_t elementsParcourusThread;
+
+/**
+ * @return l'instant actuel en nanosecondes
+ */
+static uint64_t maintenant(void);
+
+/**
+ * @param latence latence en nanosecondes
+ * @return la classe de l'histogramme comptant latence
+ */
+static size_t classeLatence(uint64_t latence);
+
+/**
+ * Ajoute valeur au compteur sans ordre mémoire
+ * @param compteur
+ * @param valeur
+ */
+static void ajouter(atomic_size_t *compteur, size_t valeur);
+
+uint64_t maintenant(void) {
+   struct timespec instant;
+   timespec_get(&instant, TIME_UTC);
+   return (uint64_t) instant.tv_sec * 1000000000u + (uint64_t) instant.tv_nsec;
+}
+
+size_t classeLatence(uint64_t latence) {
+   size_t classe = 0;
+   while (latence && classe < CLASSES_LATENCE - 1) {
+      latence >>= 1;
+      classe++;
+   }
+   return classe;
+}
+
+void ajouter(atomic_size_t *compteur, size_t valeur) {
+   atomic_fetch_add_explicit(compteur, valeur, memory_order_relaxed);
+}
+
+AppelInstrumente commencerAppel(Operation operation) {
+   ajouter(&compteurs.operations[operation].appels, 1);
+   return (AppelInstrumente) {
+      .operation = operation,
+      .debut = maintenant(),
+      .parcourusAvant = elementsParcourusThread
+   };
+}
+
+void terminerAppel(const AppelInstrumente *appel) {
+   uint64_t latence = maintenant() - appel->debut;
+   size_t parcourus = elementsParcourusThread - appel->parcourusAvant;
+   CompteursOperation *operation = &compteurs.operations[appel->operation];
+   atomic_fetch_add_explicit(&operation->duree, latence, memory_order_relaxed);
+   ajouter(&operation->latences[classeLatence(latence)], 1);
+   if (parcourus) {
+      ajouter(&operation->elementsParcourus, parcourus);
+      size_t maximum = atomic_load_explicit(&operation->maximumParcourus,
+                                            memory_order_relaxed);
+      while (parcourus > maximum &&
+             !atomic_compare_exchange_weak_explicit(&operation->maximumParcourus,
+                                                    &maximum, parcourus,
+                                                    memory_order_relaxed,
+                                                    memory_order_relaxed));
+   }
+}
+
+void compterAllocations(size_t elementsAlloues, size_t elementsRestitues,
+                        size_t allocationsSysteme, size_t liberationsSysteme) {
+   ajouter(&compteurs.elementsAlloues, elementsAlloues);
+   ajouter(&compteurs.elementsRestitues, elementsRestitues);
+   ajouter(&compteurs.allocationsSysteme, allocationsSysteme);
+   ajouter(&compteurs.liberationsSysteme, liberationsSysteme);
+}
+
+#endif
+
+/**
+ * Estime un centile à partir d'un histogramme des latences
+ * @param statistiques
+ * @param centile centile souhaité, entre 0 et 1
+ * @return la borne supérieure (en nanosecondes) de la classe contenant le
+ * centile
+ */
+static uint64_t estimerCentile(const StatistiquesOperation *statistiques,
+                               double centile);
+
+bool instrumentationActive(void) {
+#ifdef LISTES_INSTRUMENTATION
+   return true;
+#else
+   return false;
+#endif
+}
+
+void lireInstrumentation(Instrumentation *copie) {
+   memset(copie, 0, sizeof(Instrumentation));
+#ifdef LISTES_INSTRUMENTATION
+   copie->elementsAlloues = atomic_load(&compteurs.elementsAlloues);
+   copie->elementsRestitues = atomic_load(&compteurs.elementsRestitues);
+   copie->allocationsSysteme = atomic_load(&compteurs.allocationsSysteme);
+   copie->liberationsSysteme = atomic_load(&compteurs.liberationsSysteme);
+   for (size_t i = 0; i < NOMBRE_OPERATIONS; i++) {
+      CompteursOperation *source = &compteurs.operations[i];
+      StatistiquesOperation *destination = &copie->operations[i];
+      destination->appels = atomic_load(&source->appels);
+      destination->elementsParcourus = atomic_load(&source->elementsParcourus);
+      destination->maximumParcourus = atomic_load(&source->maximumParcourus);
+      destination->duree = atomic_load(&source->duree);
+      for (size_t c = 0; c < CLASSES_LATENCE; c++) {
+         destination->latences[c] = atomic_load(&source->latences[c]);
+      }
+   }
+#endif
+}
+
+void reinitialiserInstrumentation(void) {
+#ifdef LISTES_INSTRUMENTATION
+   atomic_store(&compteurs.elementsAlloues, 0);
+   atomic_store(&compteurs.elementsRestitues, 0);
+   atomic_store(&compteurs.allocationsSysteme, 0);
+   atomic_store(&compteurs.liberationsSysteme, 0);
+   for (size_t i = 0; i < NOMBRE_OPERATIONS; i++) {
+      CompteursOperation *operation = &compteurs.operations[i];
+      atomic_store(&operation->appels, 0);
+      atomic_store(&operation->elementsParcourus, 0);
+      atomic_store(&operation->maximumParcourus, 0);
+      atomic_store(&operation->duree, 0);
+      for (size_t c = 0; c < CLASSES_LATENCE; c++) {
+         atomic_store(&operation->latences[c], 0);
+      }
+   }
+#endif
+}
+
+const char *nomOperation(Operation operation) {
+   return operation < NOMBRE_OPERATIONS ? NOMS_OPERATIONS[operation] : "?";
+}
+
+uint64_t estimerCentile(const StatistiquesOperation *statistiques, double centile) {
+   size_t total = 0;
+   for (size_t c = 0; c < CLASSES_LATENCE; c++) {
+      total += statistiques->latences[c];
+   }
+   size_t rang = (size_t) (centile * (double) total);
+   size_t cumul = 0;
+   for (size_t c = 0; c < CLASSES_LATENCE; c++) {
+      cumul += statistiques->latences[c];
+      if (cumul > rang) {
+         return (uint64_t) 1 << c;
+      }
+   }
+   return (uint64_t) 1 << (CLASSES_LATENCE - 1);
+}
+
+void afficherInstrumentation(FILE *flux) {
+   if (!instrumentationActive()) {
+      fprintf(flux, "instrumentation desactivee (LISTES_INSTRUMENTATION)\n");
+      return;
+   }
+   Instrumentation instrumentation;
+   lireInstrumentation(&instrumentation);
+
+   fprintf(flux, "%-31s %12s %12s %12s %12s %14s %12s\n", "fonction", "appels",
+           "moyenne ns", "p50 ns <", "p99 ns <", "parcourus/app", "parcourus max");
+   for (size_t i = 0; i < NOMBRE_OPERATIONS; i++) {
+      const StatistiquesOperation *operation = &instrumentation.operations[i];
+      if (!operation->appels) {
+         continue;
+      }
+      fprintf(flux, "%-31s %12zu %12.0f %12llu %12llu %14.1f %12zu\n",
+              nomOperation((Operation) i), operation->appels,
+              (double) operation->duree / (double) operation->appels,
+              (unsigned long long) estimerCentile(operation, 0.5),
+              (unsigned long long) estimerCentile(operation, 0.99),
+              (double) operation->elementsParcourus / (double) operation->appels,
+              operation->maximumParcourus);
+      // histogramme : "<borne supérieure en ns>:<appels>" par classe non vide
+      fprintf(flux, "   ");
+      for (size_t c = 0; c < CLASSES_LATENCE; c++) {
+         if (operation->latences[c]) {
+            fprintf(flux, " <%llu:%zu", (unsigned long long) 1 << c,
+                    operation->latences[c]);
+         }
+      }
+      fprintf(flux, "\n");
+   }
+   fprintf(flux, "elements alloues : %zu, restitues : %zu, allocations systeme : "
+                 "%zu, liberations systeme : %zu\n", instrumentation.elementsAlloues,
+           instrumentation.elementsRestitues, instrumentation.allocationsSysteme,
+           instrumentation.liberationsSysteme);
+}
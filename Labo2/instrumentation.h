@@ -0,0 +1,122 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : instrumentation.h
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Compteurs d'exécution de la librairie de listes : appels,
+                  éléments parcourus et histogramme des latences de chaque
+                  fonction, éléments alloués et restitués.
+
+ Remarque(s)    : Les compteurs ne sont tenus à jour que si la librairie est
+                  compilée avec LISTES_INSTRUMENTATION (option CMake du même
+                  nom, désactivée par défaut, qui nécessite gcc ou clang) ;
+                  sinon l'instrumentation ne coûte rien et les compteurs restent
+                  à 0. Seule la représentation classique est instrumentée.
+                  Les compteurs sont globaux et peuvent être mis à jour depuis
+                  plusieurs threads. Un appel imbriqué (vider appelé par
+                  detruire, par exemple) est compté pour les deux fonctions.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include "listes_dynamiques.h"
+#include <stdint.h>
+#include <stdio.h>
+
+// Fonctions instrumentées : X(nom de l'opération, nom de la fonction)
+#define OPERATIONS_INSTRUMENTEES(X)                                   \
+   X(INITIALISER, initialiser)                                        \
+   X(DETRUIRE, detruire)                                              \
+   X(LONGUEUR, longueur)                                              \
+   X(AFFICHER, afficher)                                              \
+   X(INSERER_EN_TETE, insererEnTete)                                  \
+   X(INSERER_EN_QUEUE, insererEnQueue)                                \
+   X(SUPPRIMER_EN_TETE, supprimerEnTete)                              \
+   X(SUPPRIMER_EN_QUEUE, supprimerEnQueue)                            \
+   X(SUPPRIMER_SELON_CRITERE, supprimerSelonCritere)                  \
+   X(SUPPRIMER_SELON_CRITERE_PAR_LOT, supprimerSelonCritereParLot)    \
+   X(SUPPRIMER_SELON_CRITERE_PARALLELE, supprimerSelonCritereParallele) \
+   X(VIDER, vider)                                                    \
+   X(SONT_EGALES, sontEgales)                                         \
+   X(ELEMENT_A, elementA)                                             \
+   X(INSERER_TABLEAU_EN_QUEUE, insererTableauEnQueue)                 \
+   X(INSERER_TABLEAU_EN_TETE, insererTableauEnTete)                   \
+   X(INSERER_TABLEAU_EN_QUEUE_PARALLELE, insererTableauEnQueueParallele) \
+   X(COMPTER_SELON_CRITERE_PARALLELE, compterSelonCritereParallele)   \
+   X(SONT_EGALES_PARALLELE, sontEgalesParallele)                      \
+   X(REPLIER_PARALLELE, replierParallele)                             \
+   X(VERS_TABLEAU, versTableau)                                       \
+   X(CONCATENER, concatener)                                          \
+   X(COUPER_A, couperA)                                               \
+   X(TRANSFERER_PLAGE, transfererPlage)                               \
+   X(ACTIVER_INDEX_POSITIONNEL, activerIndexPositionnel)              \
+   X(ACTIVER_REPERTOIRE_SEGMENTS, activerRepertoireSegments)          \
+   X(TRIER, trier)                                                    \
+   X(COMPACTER, compacter)                                            \
+   X(INSERER_AVANT_CURSEUR, insererAvantCurseur)                      \
+   X(INSERER_APRES_CURSEUR, insererApresCurseur)                      \
+   X(SUPPRIMER_CURSEUR, supprimerCurseur)
+
+#define ENUMERER_OPERATION(OPERATION, FONCTION) OPERATION_##OPERATION,
+
+typedef enum {
+   OPERATIONS_INSTRUMENTEES(ENUMERER_OPERATION)
+   NOMBRE_OPERATIONS
+} Operation;
+
+// Nombre de classes de l'histogramme des latences : la classe c compte les
+// appels ayant duré entre 2^(c-1) (inclus) et 2^c (exclu) nanosecondes, la
+// classe 0 ceux ayant duré moins d'une nanoseconde et la dernière ceux ayant
+// duré plus longtemps
+#define CLASSES_LATENCE 40
+
+typedef struct {
+   size_t appels;
+   size_t elementsParcourus;     // somme sur tous les appels
+   size_t maximumParcourus;      // maximum pour un appel
+   uint64_t duree;               // somme des latences en nanosecondes
+   size_t latences[CLASSES_LATENCE];
+} StatistiquesOperation;
+
+typedef struct {
+   size_t elementsAlloues;
+   size_t elementsRestitues;
+   size_t allocationsSysteme;    // malloc et calloc (elements et blocs)
+   size_t liberationsSysteme;    // free (elements et blocs)
+   StatistiquesOperation operations[NOMBRE_OPERATIONS];
+} Instrumentation;
+
+// ------------------------------------------------------------------------------
+// Renvoie true si la librairie a été compilée avec LISTES_INSTRUMENTATION.
+bool instrumentationActive(void);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Copie dans copie l'état actuel des compteurs.
+void lireInstrumentation(Instrumentation *copie);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Remet tous les compteurs à 0.
+void reinitialiserInstrumentation(void);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie le nom de la fonction instrumentée operation.
+const char *nomOperation(Operation operation);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Écrit dans flux les compteurs sous forme de texte : une ligne par fonction
+// appelée au moins une fois (appels, latence moyenne, 50e et 99e centiles
+// estimés par l'histogramme, éléments parcourus en moyenne et au plus par
+// appel) suivie de son histogramme, puis les compteurs d'allocation.
+void afficherInstrumentation(FILE *flux);
+// ------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,80 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : instrumentation_internal.h
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : En-tête privé de l'instrumentation (instrumentation.h) : macros
+                  placées dans les fonctions de la librairie
+
+ Remarque(s)    : Ce fichier ne doit pas être inclus ailleurs que les fichiers
+                  source de la librairie. Sans LISTES_INSTRUMENTATION, les macros
+                  ne produisent aucun code.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+
+#ifndef INSTRUMENTATION_INTERNAL_H
+#define INSTRUMENTATION_INTERNAL_H
+
+#include "instrumentation.h"
+
+#ifdef LISTES_INSTRUMENTATION
+
+/**
+ * Appel en cours d'une fonction instrumentée
+ */
+typedef struct {
+   Operation operation;
+   uint64_t debut;               // en nanosecondes
+   size_t parcourusAvant;        // elementsParcourusThread au début de l'appel
+} AppelInstrumente;
+
+// Éléments parcourus par le thread depuis son démarrage
+extern _Thread_local size_t elementsParcourusThread;
+
+/**
+ * Compte un appel de operation et mémorise son début
+ * @param operation
+ * @return l'appel commencé
+ */
+AppelInstrumente commencerAppel(Operation operation);
+
+/**
+ * Compte la latence et les éléments parcourus de l'appel. Appelée
+ * automatiquement à la sortie de la fonction instrumentée.
+ * @param appel
+ */
+void terminerAppel(const AppelInstrumente *appel);
+
+/**
+ * Ajoute aux compteurs d'allocation
+ * @param elementsAlloues
+ * @param elementsRestitues
+ * @param allocationsSysteme
+ * @param liberationsSysteme
+ */
+void compterAllocations(size_t elementsAlloues, size_t elementsRestitues,
+                        size_t allocationsSysteme, size_t liberationsSysteme);
+
+// À placer au début d'une fonction instrumentée : la fin de l'appel est comptée
+// à la sortie de la fonction, quel que soit le return emprunté
+#define INSTRUMENTER(OPERATION)                                           \
+   AppelInstrumente appelInstrumente __attribute__((cleanup(terminerAppel))) = \
+      commencerAppel(OPERATION_##OPERATION)
+
+#define COMPTER_PARCOURUS(NOMBRE) (elementsParcourusThread += (NOMBRE))
+#define COMPTER_ALLOCATIONS(ELEMENTS, SYSTEME) compterAllocations((ELEMENTS), 0, (SYSTEME), 0)
+#define COMPTER_RESTITUTIONS(ELEMENTS, SYSTEME) compterAllocations(0, (ELEMENTS), 0, (SYSTEME))
+
+#else
+
+#define INSTRUMENTER(OPERATION) ((void) 0)
+#define COMPTER_PARCOURUS(NOMBRE) ((void) 0)
+#define COMPTER_ALLOCATIONS(ELEMENTS, SYSTEME) ((void) 0)
+#define COMPTER_RESTITUTIONS(ELEMENTS, SYSTEME) ((void) 0)
+
+#endif
+
+#endif
@@ -0,0 +1,631 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : listes_deroulees.c
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Ce fichier implémente la librairie de listes doublement
+                  chaînées non circulaires (listes_dynamiques.h) sous forme de
+                  liste déroulée : chaque element stocke jusqu'à
+                  INFOS_PAR_ELEMENT infos contiguës.
+
+ Remarque(s)    : Utilisé à la place de listes_dynamiques.c lorsque
+                  LISTES_DEROULEES est défini (option CMake du même nom).
+                  Aucune vérification sur le pointeur 'liste' passé en paramètre
+                  aux fonctions n'est effectuée
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+#include "listes_dynamiques.h"
+#include "affichage_internal.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+const char AFFICHAGE_LISTE_DEBUT = '[';
+const char AFFICHAGE_LISTE_FIN = ']';
+const char AFFICHAGE_LISTE_ENTRE_ELEMENTS = ',';
+
+/**
+ * Restitue la memoire de tous les elements à partir de element (via suivant)
+ * @param element premier element à restituer
+ */
+static void libererElements(Element *element);
+
+/**
+ * Retire element de liste, en mettant à jour tete et queue, puis restitue sa
+ * memoire
+ * @param liste liste contenant l'element
+ * @param element element à retirer
+ */
+static void retirerElement(Liste *liste, Element *element);
+
+/**
+ * Alloue une chaine de nombre elements vides liés dans les deux sens (precedent
+ * du premier et suivant du dernier à NULL)
+ * @param nombre nombre d'elements (> 0)
+ * @param fin pour retourner le dernier element de la chaine
+ * @return le premier element de la chaine ou NULL en cas de mémoire insuffisante
+ */
+static Element *creerChaine(size_t nombre, Element **fin);
+
+/**
+ * Copie nombre infos de tableau dans destination, ou des 0 si tableau vaut NULL
+ * @param destination
+ * @param tableau infos à copier ou NULL
+ * @param nombre nombre d'infos
+ */
+static void copierInfos(Info *destination, const Info *tableau, size_t nombre);
+
+/**
+ * Cherche l'element contenant l'info à la position position, depuis l'extremité
+ * la plus proche
+ * @param liste
+ * @param position position valide dans liste, remplacée par le rang de l'info
+ * dans l'element trouvé (0 pour sa premiere info)
+ * @return l'element contenant l'info
+ */
+static Element *elementContenant(const Liste *liste, size_t *position);
+
+/**
+ * Déplace dans fin les infos de liste à partir de la position position. Si
+ * position tombe au milieu d'un element, la fin de celui-ci est recopiée dans un
+ * nouvel element.
+ * @param liste
+ * @param position position inférieure ou égale à la longueur de liste
+ * @param fin liste vide recevant les infos déplacées
+ * @return OK ou MEMOIRE_INSUFFISANTE (liste n'est alors pas modifiée)
+ */
+static Status scinder(Liste *liste, size_t position, Liste *fin);
+
+Liste *initialiser(void) {
+   // on utilise calloc pour mettre directement les éléments à 0 = NULL
+   return (Liste *) calloc(1, sizeof(Liste));
+}
+
+bool estVide(const Liste *liste) {
+   return liste->tete == NULL;
+}
+
+size_t longueur(const Liste *liste) {
+   // la taille est tenue à jour par toutes les fonctions modifiant la liste
+   return liste->taille;
+}
+
+void afficher(const Liste *liste, Mode mode) {
+   afficherDans(stdout, liste, mode);
+}
+
+void formaterListe(TamponSortie *tampon, const Liste *liste, Mode mode) {
+   bool premier = true;
+   ecrireCaractere(tampon, AFFICHAGE_LISTE_DEBUT);
+   switch (mode) {
+      case FORWARD:
+         for (const Element *element = liste->tete; element;
+              element = element->suivant) {
+            for (unsigned i = element->debut; i < element->debut + element->nombre;
+                 i++) {
+               if (!premier) {
+                  ecrireCaractere(tampon, AFFICHAGE_LISTE_ENTRE_ELEMENTS);
+               }
+               ecrireInfo(tampon, element->infos[i]);
+               premier = false;
+            }
+         }
+         break;
+      case BACKWARD:
+         for (const Element *element = liste->queue; element;
+              element = element->precedent) {
+            for (unsigned i = element->debut + element->nombre; i-- > element->debut;) {
+               if (!premier) {
+                  ecrireCaractere(tampon, AFFICHAGE_LISTE_ENTRE_ELEMENTS);
+               }
+               ecrireInfo(tampon, element->infos[i]);
+               premier = false;
+            }
+         }
+         break;
+      default:
+         //on ne devrait jamais arriver ici.
+         break;
+   }
+   ecrireCaractere(tampon, AFFICHAGE_LISTE_FIN);
+}
+
+Status insererEnTete(Liste *liste, const Info *info) {
+   Element *tete = liste->tete;
+
+   // un nouvel element n'est nécessaire que s'il n'y a plus de place devant la
+   // premiere info de la tete
+   if (!tete || !tete->debut) {
+      Element *element = (Element *) calloc(1, sizeof(Element));
+      if (!element) {
+         return MEMOIRE_INSUFFISANTE;
+      }
+      // le nouvel element se remplit depuis la fin pour que les prochaines
+      // insertions en tete puissent l'utiliser
+      element->debut = INFOS_PAR_ELEMENT;
+      element->suivant = tete;
+      if (tete) {
+         tete->precedent = element;
+      } else {
+         liste->queue = element;
+      }
+      liste->tete = tete = element;
+   }
+
+   tete->debut--;
+   tete->nombre++;
+   tete->infos[tete->debut] = info ? *info : 0;
+   liste->taille++;
+   return OK;
+}
+
+Status insererEnQueue(Liste *liste, const Info *info) {
+   Element *queue = liste->queue;
+
+   // un nouvel element n'est nécessaire que s'il n'y a plus de place derriere la
+   // derniere info de la queue
+   if (!queue || queue->debut + queue->nombre == INFOS_PAR_ELEMENT) {
+      Element *element = (Element *) calloc(1, sizeof(Element));
+      if (!element) {
+         return MEMOIRE_INSUFFISANTE;
+      }
+      element->precedent = queue;
+      if (queue) {
+         queue->suivant = element;
+      } else {
+         liste->tete = element;
+      }
+      liste->queue = queue = element;
+   }
+
+   queue->infos[queue->debut + queue->nombre++] = info ? *info : 0;
+   liste->taille++;
+   return OK;
+}
+
+void retirerElement(Liste *liste, Element *element) {
+   if (element->precedent) {
+      element->precedent->suivant = element->suivant;
+   } else {
+      liste->tete = element->suivant;
+   }
+   if (element->suivant) {
+      element->suivant->precedent = element->precedent;
+   } else {
+      liste->queue = element->precedent;
+   }
+   free(element);
+}
+
+Status supprimerEnTete(Liste *liste, Info *info) {
+   // verifier si la liste est vide avant de faire quoi que ce soit
+   if (estVide(liste)) {
+      return LISTE_VIDE;
+   }
+
+   Element *tete = liste->tete;
+   if (info) {
+      *info = tete->infos[tete->debut];
+   }
+   tete->debut++;
+   liste->taille--;
+
+   // un element ne reste jamais vide
+   if (!--tete->nombre) {
+      retirerElement(liste, tete);
+   }
+   return OK;
+}
+
+Status supprimerEnQueue(Liste *liste, Info *info) {
+   // verifier si la liste est vide avant de faire quoi que ce soit
+   if (estVide(liste)) {
+      return LISTE_VIDE;
+   }
+
+   Element *queue = liste->queue;
+   queue->nombre--;
+   liste->taille--;
+   if (info) {
+      *info = queue->infos[queue->debut + queue->nombre];
+   }
+
+   // un element ne reste jamais vide
+   if (!queue->nombre) {
+      retirerElement(liste, queue);
+   }
+   return OK;
+}
+
+void supprimerSelonCritere(Liste *liste,
+                           bool (*critere)(size_t position, const Info *info)) {
+   // verifier les parametres d'entree
+   if (!critere || estVide(liste)) {
+      return;
+   }
+
+   // Les infos conservées sont recopiées de manière contiguë à partir de la tete
+   // (ecriture), ce qui garde les elements pleins. L'ecriture ne dépasse jamais
+   // la lecture : une info est toujours lue avant d'être écrasée.
+   Element *ecriture = liste->tete;
+   unsigned finEcriture = ecriture->debut;
+   size_t position = 0;
+   size_t conserves = 0;
+
+   for (Element *lecture = liste->tete; lecture; lecture = lecture->suivant) {
+      // les bornes de lecture sont figées avant que l'ecriture ne modifie l'element
+      const unsigned fin = lecture->debut + lecture->nombre;
+      for (unsigned i = lecture->debut; i < fin; i++, position++) {
+         if (critere(position, &lecture->infos[i])) {
+            continue;
+         }
+         if (finEcriture == INFOS_PAR_ELEMENT) {
+            // element d'ecriture plein, on passe au suivant (déjà lu jusqu'ici)
+            ecriture->nombre = finEcriture - ecriture->debut;
+            ecriture = ecriture->suivant;
+            ecriture->debut = finEcriture = 0;
+         }
+         ecriture->infos[finEcriture++] = lecture->infos[i];
+         conserves++;
+      }
+   }
+   liste->taille = conserves;
+
+   ecriture->nombre = finEcriture - ecriture->debut;
+   if (!ecriture->nombre) {
+      // l'ecriture n'a jamais quitté la tete : aucune info n'a été conservée
+      libererElements(liste->tete);
+      liste->tete = liste->queue = NULL;
+      return;
+   }
+   libererElements(ecriture->suivant);
+   ecriture->suivant = NULL;
+   liste->queue = ecriture;
+}
+
+void vider(Liste *liste, size_t position) {
+   if (position >= liste->taille) {
+      // position non valide
+      return;
+   }
+   // chercher l'element contenant l'info à la position position, depuis
+   // l'extremité la plus proche : vider les k dernieres infos coûte O(k)
+   size_t rang = position;
+   Element *element = elementContenant(liste, &rang);
+   liste->taille = position;
+
+   libererElements(element->suivant);
+   element->suivant = NULL;
+   liste->queue = element;
+
+   // les infos de element à partir du rang rang sont retirées
+   element->nombre = (unsigned) rang;
+   if (!element->nombre) {
+      retirerElement(liste, element);
+   }
+}
+
+Status elementA(const Liste *liste, size_t position, Info *info) {
+   if (position >= liste->taille) {
+      return POSITION_NON_VALIDE;
+   }
+   const Element *element = elementContenant(liste, &position);
+   if (info) {
+      *info = element->infos[element->debut + position];
+   }
+   return OK;
+}
+
+Element *elementContenant(const Liste *liste, size_t *position) {
+   // on saute d'element en element jusqu'à celui contenant la position, depuis
+   // l'extremité la plus proche
+   Element *element;
+   if (*position < liste->taille / 2) {
+      element = liste->tete;
+      while (*position >= element->nombre) {
+         *position -= element->nombre;
+         element = element->suivant;
+      }
+   } else {
+      // rang depuis la queue, puis rang dans l'element trouvé
+      size_t rang = liste->taille - 1 - *position;
+      element = liste->queue;
+      while (rang >= element->nombre) {
+         rang -= element->nombre;
+         element = element->precedent;
+      }
+      *position = element->nombre - 1 - rang;
+   }
+   return element;
+}
+
+Status scinder(Liste *liste, size_t position, Liste *fin) {
+   if (position == liste->taille) {
+      return OK;
+   }
+   size_t rang = position;
+   Element *premier = elementContenant(liste, &rang);
+   if (rang) {
+      // la fin de l'element est recopiée dans un nouvel element, placé après lui
+      Element *element = premier;
+      premier = (Element *) calloc(1, sizeof(Element));
+      if (!premier) {
+         return MEMOIRE_INSUFFISANTE;
+      }
+      premier->nombre = element->nombre - (unsigned) rang;
+      memcpy(premier->infos, &element->infos[element->debut + rang],
+             premier->nombre * sizeof(Info));
+      element->nombre = (unsigned) rang;
+      premier->precedent = element;
+      premier->suivant = element->suivant;
+      if (element->suivant) {
+         element->suivant->precedent = premier;
+      } else {
+         liste->queue = premier;
+      }
+      element->suivant = premier;
+   }
+
+   fin->tete = premier;
+   fin->queue = liste->queue;
+   fin->taille = liste->taille - position;
+   liste->queue = premier->precedent;
+   if (liste->queue) {
+      liste->queue->suivant = NULL;
+   } else {
+      liste->tete = NULL;
+   }
+   premier->precedent = NULL;
+   liste->taille = position;
+   return OK;
+}
+
+Status concatener(Liste *destination, Liste *source) {
+   if (destination == source || estVide(source)) {
+      return OK;
+   }
+   // les elements peuvent rester partiellement remplis : il suffit de les
+   // rechainer
+   source->tete->precedent = destination->queue;
+   if (destination->queue) {
+      destination->queue->suivant = source->tete;
+   } else {
+      destination->tete = source->tete;
+   }
+   destination->queue = source->queue;
+   destination->taille += source->taille;
+
+   source->tete = source->queue = NULL;
+   source->taille = 0;
+   return OK;
+}
+
+Liste *couperA(Liste *liste, size_t position) {
+   if (position > liste->taille) {
+      return NULL;
+   }
+   Liste *nouvelle = initialiser();
+   if (nouvelle && scinder(liste, position, nouvelle) != OK) {
+      free(nouvelle);
+      return NULL;
+   }
+   return nouvelle;
+}
+
+Status transfererPlage(Liste *destination, size_t position, Liste *source,
+                       size_t debut, size_t nombre) {
+   if (destination == source || debut > source->taille ||
+       nombre > source->taille - debut || position > destination->taille) {
+      return POSITION_NON_VALIDE;
+   }
+   if (!nombre) {
+      return OK;
+   }
+   // chaque coupe peut allouer un element : en cas d'echec, les morceaux déjà
+   // coupés sont raccordés (ce qui n'alloue rien)
+   Liste finSource = {NULL, NULL, 0};
+   Liste plage = {NULL, NULL, 0};
+   Liste finDestination = {NULL, NULL, 0};
+   if (scinder(source, debut + nombre, &finSource) != OK) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+   if (scinder(source, debut, &plage) != OK) {
+      concatener(source, &finSource);
+      return MEMOIRE_INSUFFISANTE;
+   }
+   if (scinder(destination, position, &finDestination) != OK) {
+      concatener(source, &plage);
+      concatener(source, &finSource);
+      return MEMOIRE_INSUFFISANTE;
+   }
+   concatener(source, &finSource);
+   concatener(destination, &plage);
+   concatener(destination, &finDestination);
+   return OK;
+}
+
+Element *creerChaine(size_t nombre, Element **fin) {
+   Element *debut = NULL;
+   Element *dernier = NULL;
+   for (size_t i = 0; i < nombre; i++) {
+      Element *element = (Element *) calloc(1, sizeof(Element));
+      if (!element) {
+         libererElements(debut);
+         return NULL;
+      }
+      element->precedent = dernier;
+      if (dernier) {
+         dernier->suivant = element;
+      } else {
+         debut = element;
+      }
+      dernier = element;
+   }
+   *fin = dernier;
+   return debut;
+}
+
+void copierInfos(Info *destination, const Info *tableau, size_t nombre) {
+   if (tableau) {
+      memcpy(destination, tableau, nombre * sizeof(Info));
+   } else {
+      memset(destination, 0, nombre * sizeof(Info));
+   }
+}
+
+Status insererTableauEnQueue(Liste *liste, const Info *tableau, size_t nombre) {
+   Element *queue = liste->queue;
+   // on complete d'abord la place libre derriere la derniere info de la queue
+   size_t place = queue ? INFOS_PAR_ELEMENT - queue->debut - queue->nombre : 0;
+   size_t dansQueue = nombre < place ? nombre : place;
+   size_t reste = nombre - dansQueue;
+
+   // tous les elements sont alloués avant de modifier la liste
+   Element *debut = NULL;
+   Element *fin = NULL;
+   if (reste && !(debut = creerChaine((reste + INFOS_PAR_ELEMENT - 1) /
+                                      INFOS_PAR_ELEMENT, &fin))) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+
+   if (dansQueue) {
+      copierInfos(&queue->infos[queue->debut + queue->nombre], tableau, dansQueue);
+      queue->nombre += (unsigned) dansQueue;
+      if (tableau) {
+         tableau += dansQueue;
+      }
+   }
+   // les nouveaux elements sont remplis depuis le debut, le dernier pouvant
+   // rester incomplet
+   for (Element *element = debut; element; element = element->suivant) {
+      size_t copies = reste < INFOS_PAR_ELEMENT ? reste : INFOS_PAR_ELEMENT;
+      copierInfos(element->infos, tableau, copies);
+      element->nombre = (unsigned) copies;
+      if (tableau) {
+         tableau += copies;
+      }
+      reste -= copies;
+   }
+
+   if (debut) {
+      debut->precedent = queue;
+      if (queue) {
+         queue->suivant = debut;
+      } else {
+         liste->tete = debut;
+      }
+      liste->queue = fin;
+   }
+   liste->taille += nombre;
+   return OK;
+}
+
+Status insererTableauEnTete(Liste *liste, const Info *tableau, size_t nombre) {
+   Element *tete = liste->tete;
+   // les dernieres infos de tableau vont dans la place libre devant la premiere
+   // info de la tete
+   size_t place = tete ? tete->debut : 0;
+   size_t dansTete = nombre < place ? nombre : place;
+   size_t reste = nombre - dansTete;
+
+   // tous les elements sont alloués avant de modifier la liste
+   Element *debut = NULL;
+   Element *fin = NULL;
+   if (reste && !(debut = creerChaine((reste + INFOS_PAR_ELEMENT - 1) /
+                                      INFOS_PAR_ELEMENT, &fin))) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+
+   if (dansTete) {
+      tete->debut -= (unsigned) dansTete;
+      tete->nombre += (unsigned) dansTete;
+      copierInfos(&tete->infos[tete->debut], tableau ? tableau + reste : NULL,
+                  dansTete);
+   }
+   // comme pour insererEnTete, le premier nouvel element est rempli depuis la
+   // fin pour que les prochaines insertions en tete puissent l'utiliser
+   for (Element *element = debut; element; element = element->suivant) {
+      size_t copies = reste % INFOS_PAR_ELEMENT;
+      if (element != debut || !copies) {
+         copies = INFOS_PAR_ELEMENT;
+      }
+      element->debut = (unsigned) (INFOS_PAR_ELEMENT - copies);
+      element->nombre = (unsigned) copies;
+      copierInfos(&element->infos[element->debut], tableau, copies);
+      if (tableau) {
+         tableau += copies;
+      }
+   }
+
+   if (debut) {
+      fin->suivant = tete;
+      if (tete) {
+         tete->precedent = fin;
+      } else {
+         liste->queue = fin;
+      }
+      liste->tete = debut;
+   }
+   liste->taille += nombre;
+   return OK;
+}
+
+size_t versTableau(const Liste *liste, Info *tableau, size_t capacite) {
+   size_t copies = 0;
+   for (const Element *element = liste->tete; element && copies < capacite;
+        element = element->suivant) {
+      size_t nombre = capacite - copies < element->nombre ? capacite - copies
+                                                          : element->nombre;
+      memcpy(tableau + copies, &element->infos[element->debut],
+             nombre * sizeof(Info));
+      copies += nombre;
+   }
+   return copies;
+}
+
+void libererElements(Element *element) {
+   while (element) {
+      Element *tmp = element;
+      element = element->suivant;
+      free(tmp);
+   }
+}
+
+bool sontEgales(const Liste *liste1, const Liste *liste2) {
+   // des listes de longueurs différentes ne peuvent pas être égales
+   if (liste1->taille != liste2->taille) {
+      return false;
+   }
+
+   const Element *element1 = liste1->tete;
+   const Element *element2 = liste2->tete;
+   unsigned i1 = element1 ? element1->debut : 0;
+   unsigned i2 = element2 ? element2->debut : 0;
+
+   // itérer tant qu'on a des elements valables dans les deux listes
+   while (element1 && element2) {
+      if (element1->infos[i1] != element2->infos[i2]) {
+         return false;
+      }
+      if (++i1 == element1->debut + element1->nombre) {
+         element1 = element1->suivant;
+         i1 = element1 ? element1->debut : 0;
+      }
+      if (++i2 == element2->debut + element2->nombre) {
+         element2 = element2->suivant;
+         i2 = element2 ? element2->debut : 0;
+      }
+   }
+   // les listes sont égales si on est arrivé à la fin des deux en même temps
+   return element1 == NULL && element2 == NULL;
+}
+
+void detruire(Liste *liste) {
+   if (liste) {
+      libererElements(liste->tete);
+      free(liste);
+   }
+}
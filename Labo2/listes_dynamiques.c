@@ -14,16 +14,34 @@
  -----------------------------------------------------------------------------------
 */
 #include "listes_dynamiques.h"
+#include "listes_dynamiques_internal.h"
+#include "affichage_internal.h"
+#include "instrumentation_internal.h"
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 const char AFFICHAGE_LISTE_DEBUT = '[';
 const char AFFICHAGE_LISTE_FIN = ']';
 const char AFFICHAGE_LISTE_ENTRE_ELEMENTS = ',';
 
+// Nombre d'éléments par bloc d'un réservoir si l'appelant ne le précise pas
+const size_t RESERVOIR_ELEMENTS_PAR_BLOC = 4096;
+
+// Capacité initiale (puissance de 2) d'un index positionnel
+const size_t INDEX_CAPACITE_MINIMALE = 16;
+
+// Base (impaire) de l'empreinte et son inverse modulo 2^64
+const uint64_t BASE_EMPREINTE = 0x9E3779B97F4A7C15u;
+const uint64_t BASE_EMPREINTE_INVERSE = 0xF1DE83E19937733Du;
+
+// Pas d'un répertoire de segments si l'appelant ne le précise pas
+const size_t REPERTOIRE_PAS_PAR_DEFAUT = 1024;
+
 /**
  * Macro pour creer des fonctions d'affichage selon le premier element et le
- * prochain element
+ * prochain element. Les fonctions creees produisent le texte dans un tampon.
  * @param SUFFIX suffix du nom de la fonction (afficher#SUFFIX)
  * @param PREMIER_ELEMENT comment atteindre le premier element de la liste (tete
  * ou queue)
@@ -31,74 +49,651 @@ const char AFFICHAGE_LISTE_ENTRE_ELEMENTS = ',';
  * (prochain ou suivant)
  */
 #define CREER_FONCTION_AFFICHER(SUFFIX, PREMIER_ELEMENT, PROCHAIN)\
-void afficher##SUFFIX (const Liste* liste)                        \
+static void afficher##SUFFIX (TamponSortie* tampon, const Liste* liste)\
 {                                                                 \
-   printf("%c", AFFICHAGE_LISTE_DEBUT);                           \
+   ecrireCaractere(tampon, AFFICHAGE_LISTE_DEBUT);                \
    if(!estVide(liste))                                            \
    {                                                              \
       Element* elementActuel = liste->PREMIER_ELEMENT;            \
-      printf("%d", elementActuel->info);                          \
+      ecrireInfo(tampon, elementActuel->info);                    \
       while((elementActuel = elementActuel->PROCHAIN))            \
       {                                                           \
-         printf("%c", AFFICHAGE_LISTE_ENTRE_ELEMENTS);            \
-         printf("%d", elementActuel->info);                       \
+         ecrireCaractere(tampon, AFFICHAGE_LISTE_ENTRE_ELEMENTS); \
+         ecrireInfo(tampon, elementActuel->info);                 \
       }                                                           \
    }                                                              \
-   printf("%c", AFFICHAGE_LISTE_FIN);                             \
+   ecrireCaractere(tampon, AFFICHAGE_LISTE_FIN);                  \
 }
 
 CREER_FONCTION_AFFICHER(EnAvant, tete, suivant)
 
 CREER_FONCTION_AFFICHER(EnArriere, queue, precedent)
 
+// Nombre d'elements consécutifs dont trier trie d'abord les infos dans un
+// tableau (sur la pile), avant de fusionner les blocs obtenus
+#define TAILLE_BLOC_TRI 2048
+
+// Longueur des sequences triées par insertion avant les fusions d'un bloc
+#define TAILLE_SEQUENCE_INSERTION 16
+
+// Pendant le tri, le champ precedent de chaque element sert de case de tampon
+// pour une info
+_Static_assert(sizeof(Info) <= sizeof(Element *),
+               "une info doit tenir dans le champ precedent d'un element");
+
+/**
+ * Lit l'info d'element, ou celle rangée dans son champ precedent
+ * @param element
+ * @param dansPrecedent true pour lire l'info rangée dans precedent
+ * @return l'info lue
+ */
+static inline Info lireCase(const Element *element, bool dansPrecedent) {
+   if (!dansPrecedent) {
+      return element->info;
+   }
+   Info info;
+   memcpy(&info, &element->precedent, sizeof(Info));
+   return info;
+}
+
+/**
+ * Ecrit info dans element, ou la range dans son champ precedent
+ * @param element
+ * @param dansPrecedent true pour ranger info dans precedent
+ * @param info
+ */
+static inline void ecrireCase(Element *element, bool dansPrecedent, Info info) {
+   if (dansPrecedent) {
+      memcpy(&element->precedent, &info, sizeof(Info));
+   } else {
+      element->info = info;
+   }
+}
+
+/**
+ * Macro pour creer les fonctions de tri par fusion selon la comparaison de deux
+ * infos. Les infos sont déplacées d'element en element, la chaine des suivant
+ * n'est pas modifiée ; les precedent, utilisés comme tampon, sont à
+ * recalculer ensuite.
+ * @param SUFFIX suffix du nom des fonctions (trierTableau#SUFFIX,
+ * fusionnerSequences#SUFFIX, trierInfos#SUFFIX)
+ * @param PRECEDE_OU_EGALE expression vraie si l'info pointée par a peut être
+ * placée avant celle pointée par b (comparer désignant le comparateur passé à
+ * trier)
+ */
+#define CREER_FONCTIONS_TRIER(SUFFIX, PRECEDE_OU_EGALE)                    \
+static Info *trierTableau##SUFFIX(Info *infos, Info *tampon, size_t nombre,\
+                                  int (*comparer)(const Info *, const Info *)) \
+{                                                                         \
+   (void) comparer;                                                       \
+   for (size_t debut = 0; debut < nombre; debut += TAILLE_SEQUENCE_INSERTION) { \
+      size_t fin = nombre - debut < TAILLE_SEQUENCE_INSERTION             \
+                   ? nombre : debut + TAILLE_SEQUENCE_INSERTION;          \
+      for (size_t i = debut + 1; i < fin; i++) {                          \
+         Info info = infos[i];                                            \
+         size_t j = i;                                                    \
+         for (; j > debut && !PRECEDE_OU_EGALE(&infos[j - 1], &info); j--) { \
+            infos[j] = infos[j - 1];                                      \
+         }                                                                \
+         infos[j] = info;                                                 \
+      }                                                                   \
+   }                                                                      \
+   /* fusions de sequences voisines, alternativement vers tampon et infos */ \
+   for (size_t largeur = TAILLE_SEQUENCE_INSERTION; largeur < nombre;     \
+        largeur *= 2) {                                                   \
+      for (size_t debut = 0; debut < nombre; debut += 2 * largeur) {      \
+         size_t milieu = nombre - debut < largeur ? nombre : debut + largeur; \
+         size_t fin = nombre - milieu < largeur ? nombre : milieu + largeur; \
+         size_t i = debut, j = milieu, k = debut;                         \
+         while (i < milieu && j < fin) {                                  \
+            tampon[k++] = PRECEDE_OU_EGALE(&infos[i], &infos[j])          \
+                          ? infos[i++] : infos[j++];                      \
+         }                                                                \
+         while (i < milieu) {                                             \
+            tampon[k++] = infos[i++];                                     \
+         }                                                                \
+         while (j < fin) {                                                \
+            tampon[k++] = infos[j++];                                     \
+         }                                                                \
+      }                                                                   \
+      Info *echange = infos;                                              \
+      infos = tampon;                                                     \
+      tampon = echange;                                                   \
+   }                                                                      \
+   return infos;                                                          \
+}                                                                         \
+static void fusionnerSequences##SUFFIX(Element *tete, size_t taille,      \
+                                       size_t largeur, bool versPrecedent, \
+                                       int (*comparer)(const Info *, const Info *)) \
+{                                                                         \
+   (void) comparer;                                                       \
+   /* les sequences triées de largeur infos sont fusionnées deux à deux, */ \
+   /* le resultat étant écrit dans l'autre case des mêmes elements */     \
+   Element *sortie = tete;                                                \
+   for (size_t debut = 0; debut < taille; debut += 2 * largeur) {         \
+      size_t nombreGauche = taille - debut < largeur ? taille - debut : largeur; \
+      size_t reste = taille - debut - nombreGauche;                       \
+      size_t nombreDroite = reste < largeur ? reste : largeur;            \
+      Element *gauche = sortie;                                           \
+      Element *droite = sortie;                                           \
+      for (size_t i = 0; i < nombreGauche; i++) {                         \
+         droite = droite->suivant;                                        \
+      }                                                                   \
+      while (nombreGauche && nombreDroite) {                              \
+         Info infoGauche = lireCase(gauche, !versPrecedent);              \
+         Info infoDroite = lireCase(droite, !versPrecedent);              \
+         /* à egalité, l'info de gauche passe en premier : tri stable. */ \
+         /* Sans branchement : le choix est imprévisible sur des infos */ \
+         /* aléatoires */                                                  \
+         bool prendreGauche = PRECEDE_OU_EGALE(&infoGauche, &infoDroite); \
+         ecrireCase(sortie, versPrecedent,                                \
+                    prendreGauche ? infoGauche : infoDroite);             \
+         Element *suivantGauche = gauche->suivant;                        \
+         Element *suivantDroite = droite->suivant;                        \
+         gauche = prendreGauche ? suivantGauche : gauche;                 \
+         droite = prendreGauche ? droite : suivantDroite;                 \
+         nombreGauche -= prendreGauche;                                   \
+         nombreDroite -= !prendreGauche;                                  \
+         sortie = sortie->suivant;                                        \
+      }                                                                   \
+      for (; nombreGauche; nombreGauche--) {                              \
+         ecrireCase(sortie, versPrecedent, lireCase(gauche, !versPrecedent)); \
+         gauche = gauche->suivant;                                        \
+         sortie = sortie->suivant;                                        \
+      }                                                                   \
+      for (; nombreDroite; nombreDroite--) {                              \
+         ecrireCase(sortie, versPrecedent, lireCase(droite, !versPrecedent)); \
+         droite = droite->suivant;                                        \
+         sortie = sortie->suivant;                                        \
+      }                                                                   \
+   }                                                                      \
+}                                                                         \
+static void trierInfos##SUFFIX(Liste *liste,                              \
+                               int (*comparer)(const Info *, const Info *)) \
+{                                                                         \
+   Info infos[TAILLE_BLOC_TRI];                                           \
+   Info tampon[TAILLE_BLOC_TRI];                                          \
+   /* les infos de chaque bloc d'elements consécutifs sont triées sur la */ \
+   /* pile puis réécrites dans les mêmes elements */                      \
+   COMPTER_PARCOURUS(liste->taille);                                      \
+   for (Element *bloc = liste->tete; bloc;) {                             \
+      size_t nombre = 0;                                                  \
+      for (Element *element = bloc; element && nombre < TAILLE_BLOC_TRI;  \
+           element = element->suivant) {                                  \
+         infos[nombre++] = element->info;                                 \
+      }                                                                   \
+      const Info *blocTrie = trierTableau##SUFFIX(infos, tampon, nombre,  \
+                                                  comparer);              \
+      for (size_t i = 0; i < nombre; i++, bloc = bloc->suivant) {         \
+         bloc->info = blocTrie[i];                                        \
+      }                                                                   \
+   }                                                                      \
+   bool dansPrecedent = false;                                            \
+   for (size_t largeur = TAILLE_BLOC_TRI; largeur < liste->taille; largeur *= 2) { \
+      COMPTER_PARCOURUS(liste->taille);                                   \
+      fusionnerSequences##SUFFIX(liste->tete, liste->taille, largeur,     \
+                                 !dansPrecedent, comparer);               \
+      dansPrecedent = !dansPrecedent;                                     \
+   }                                                                      \
+   for (Element *element = liste->tete; dansPrecedent && element;         \
+        element = element->suivant) {                                     \
+      element->info = lireCase(element, true);                            \
+   }                                                                      \
+}
+
+#define INFO_PRECEDE_OU_EGALE(a, b) (*(a) <= *(b))
+#define COMPARAISON_PRECEDE_OU_EGALE(a, b) (comparer((a), (b)) <= 0)
+
+CREER_FONCTIONS_TRIER(ParValeur, INFO_PRECEDE_OU_EGALE)
+
+CREER_FONCTIONS_TRIER(ParComparateur, COMPARAISON_PRECEDE_OU_EGALE)
+
+/**
+ * Abandonne une reference sur reservoir et restitue tous ses blocs si c'etait
+ * la derniere
+ * @param reservoir
+ * @return true si le reservoir a été restitué, false sinon
+ */
+static bool relacherReservoir(ReservoirElements *reservoir);
+
+/**
+ * Ajoute à reservoir un nouveau bloc de elementsParBloc elements à découper
+ * @param reservoir
+ * @return true si le bloc a pu être alloué, false sinon
+ */
+static bool ajouterBloc(ReservoirElements *reservoir);
+
+/**
+ * Alloue pour liste une chaine de nombre elements liés dans les deux sens,
+ * contenant les infos de tableau (0 si tableau vaut NULL). Les extremités de la
+ * chaine ne sont pas reliées (precedent du premier et suivant du dernier à NULL).
+ * @param liste liste qui va contenir les elements
+ * @param tableau infos des elements ou NULL
+ * @param nombre nombre d'elements (> 0)
+ * @param fin pour retourner le dernier element de la chaine
+ * @return le premier element de la chaine ou NULL en cas de mémoire insuffisante
+ * (liste est alors laissée telle quelle, sans reservoir si elle n'en avait pas)
+ */
+static Element *creerChaine(Liste *liste, const Info *tableau, size_t nombre,
+                            Element **fin);
+
+/**
+ * Mélange les bits d'une info pour que des infos proches contribuent de manière
+ * très différente à l'empreinte
+ * @param info
+ * @return l'info mélangée
+ */
+static uint64_t melangerInfo(Info info);
+
+/**
+ * Répercute sur l'empreinte de liste (si elle existe et est valide) l'insertion
+ * de info en tete
+ * @param liste liste dont la taille n'inclut pas encore info
+ * @param info info insérée
+ */
+static void ajouterEmpreinteEnTete(Liste *liste, Info info);
+
+/**
+ * Répercute sur l'empreinte de liste (si elle existe et est valide) l'insertion
+ * de info en queue
+ * @param liste liste dont la taille n'inclut pas encore info
+ * @param info info insérée
+ */
+static void ajouterEmpreinteEnQueue(Liste *liste, Info info);
+
+/**
+ * Répercute sur l'empreinte de liste (si elle existe et est valide) la
+ * suppression de info en tete
+ * @param liste
+ * @param info info supprimée
+ */
+static void retirerEmpreinteEnTete(Liste *liste, Info info);
+
+/**
+ * Répercute sur l'empreinte de liste (si elle existe et est valide) la
+ * suppression de info en queue
+ * @param liste
+ * @param info info supprimée
+ */
+static void retirerEmpreinteEnQueue(Liste *liste, Info info);
+
+/**
+ * Garantit que repertoire peut contenir nombre entrées, en doublant sa capacité
+ * autant que nécessaire
+ * @param repertoire
+ * @param nombre nombre d'entrées
+ * @return true si le répertoire a la place nécessaire, false sinon
+ */
+static bool agrandirRepertoire(RepertoireSegments *repertoire, size_t nombre);
+
+/**
+ * Répercute sur le répertoire de segments de liste (s'il existe et est valide)
+ * l'insertion en queue de la chaine debut -> ... de nombre elements. Le
+ * répertoire est invalidé s'il ne peut pas grandir.
+ * @param liste liste dont la taille n'inclut pas encore la chaine
+ * @param debut premier element inséré
+ * @param nombre nombre d'elements insérés
+ */
+static void repertorierEnQueue(Liste *liste, Element *debut, size_t nombre);
+
+/**
+ * Retire du répertoire de segments de liste (s'il existe et est valide) les
+ * entrées au-delà de sa queue, après une suppression en queue
+ * @param liste liste dont la taille est déjà à jour
+ */
+static void tronquerRepertoire(Liste *liste);
+
 /**
  *
+ * @param liste liste contenant l'element a supprimer
  * @param element pointeur vers l'element a supprimer
  * @param info pointeur pour retourner l'information qui se trouve dans l'element
  * a supprimer
  */
-static void supprimerElement(Element *element, Info *info);
+static void supprimerElement(Liste *liste, Element *element, Info *info);
 
 /**
- *
- * @param liste liste sur laquelle on veut trouver l'element
- * @param position position de la liste de l'element souhaité
- * @param element paramètre d'entrée/sortie pour retourner l'element à position
- * position. Si NULL est passé en paramètre, ce pointeur n'est pas modifié.
- * @return OK si on a trouvé l'element. POSITION_NON_VALIDE si la position
- * position n'est pas valide.
+ * Détache de liste la chaine d'elements premier -> ... -> dernier, sans les
+ * restituer. Les extremités de la chaine ne sont plus reliées (precedent de
+ * premier et suivant de dernier à NULL).
+ * @param liste
+ * @param premier premier element de la chaine
+ * @param dernier dernier element de la chaine
+ * @param position position de premier dans liste
+ * @param nombre nombre d'elements de la chaine
  */
-static Status getElement(const Liste *liste, size_t position, Element **element);
+static void detacherChaine(Liste *liste, Element *premier, Element *dernier,
+                           size_t position, size_t nombre);
+
+/**
+ * Chaîne dans liste, juste après precedent, la chaine d'elements premier -> ...
+ * -> dernier
+ * @param liste liste dont l'index (s'il existe) a la place pour nombre elements
+ * @param precedent element après lequel insérer (NULL : en tete)
+ * @param premier premier element de la chaine
+ * @param dernier dernier element de la chaine
+ * @param nombre nombre d'elements de la chaine
+ */
+static void insererChaine(Liste *liste, Element *precedent, Element *premier,
+                          Element *dernier, size_t nombre);
+
+/**
+ * Déplace la chaine premier -> ... -> dernier de source dans destination, juste
+ * après precedent. Les elements sont rechaînés si les deux listes ont le même
+ * reservoir, recopiés dans des elements de destination sinon.
+ * @param destination
+ * @param precedent element de destination après lequel insérer (NULL : en tete)
+ * @param source
+ * @param premier premier element de la chaine
+ * @param dernier dernier element de la chaine
+ * @param position position de premier dans source
+ * @param nombre nombre d'elements de la chaine
+ * @return OK ou MEMOIRE_INSUFFISANTE (les listes ne sont alors pas modifiées)
+ */
+static Status deplacerChaine(Liste *destination, Element *precedent, Liste *source,
+                             Element *premier, Element *dernier, size_t position,
+                             size_t nombre);
+
+/**
+ * Insère dans l'index positionnel de liste (s'il existe) element à la position
+ * position, en décalant les elements depuis l'extremité la plus proche
+ * @param liste liste dont la taille n'inclut pas encore element et dont l'index a
+ * la place nécessaire
+ * @param position position de element
+ * @param element element inséré
+ */
+static void insererDansIndex(Liste *liste, size_t position, Element *element);
+
+/**
+ * Retire de l'index positionnel de liste (s'il existe) l'element à la position
+ * position, en décalant les elements depuis l'extremité la plus proche
+ * @param liste liste dont la taille inclut encore l'element retiré
+ * @param position position de l'element retiré
+ */
+static void retirerDeIndex(Liste *liste, size_t position);
+
+/**
+ * Insère un nouvel element (contenant info) entre precedent et son suivant, tous
+ * deux existants
+ * @param liste
+ * @param precedent element après lequel insérer, qui n'est pas la queue
+ * @param position position du nouvel element
+ * @param info info du nouvel element (0 si NULL)
+ * @return OK ou MEMOIRE_INSUFFISANTE
+ */
+static Status insererEntre(Liste *liste, Element *precedent, size_t position,
+                           const Info *info);
 
 Liste *initialiser(void) {
+   INSTRUMENTER(INITIALISER);
    // on utilise calloc pour mettre directement les éléments à 0 = NULL
    return (Liste *) calloc(1, sizeof(Liste));
 }
 
+ReservoirElements *creerReservoir(size_t elementsParBloc) {
+   ReservoirElements *reservoir =
+      (ReservoirElements *) calloc(1, sizeof(ReservoirElements));
+   if (reservoir) {
+      reservoir->elementsParBloc =
+         elementsParBloc ? elementsParBloc : RESERVOIR_ELEMENTS_PAR_BLOC;
+      reservoir->references = 1;
+   }
+   return reservoir;
+}
+
+void libererReservoir(ReservoirElements *reservoir) {
+   if (reservoir) {
+      relacherReservoir(reservoir);
+   }
+}
+
+Liste *initialiserAvecReservoir(ReservoirElements *reservoir) {
+   Liste *liste = initialiser();
+   if (!liste) {
+      return NULL;
+   }
+
+   if (reservoir) {
+      reservoir->references++;
+   } else {
+      // reservoir privé : la seule reference est celle de la liste
+      reservoir = creerReservoir(0);
+      if (!reservoir) {
+         free(liste);
+         return NULL;
+      }
+   }
+   liste->reservoir = reservoir;
+   return liste;
+}
+
+void detruire(Liste *liste) {
+   INSTRUMENTER(DETRUIRE);
+   if (!liste) {
+      return;
+   }
+   desactiverIndexPositionnel(liste);
+   desactiverEmpreinte(liste);
+   desactiverRepertoireSegments(liste);
+   // si on est le dernier utilisateur du reservoir, inutile de lui rendre les
+   // elements un par un : tous ses blocs viennent d'etre restitués
+   if (!liste->reservoir || !relacherReservoir(liste->reservoir)) {
+      // le reservoir est toujours utilisé par d'autres, on lui rend nos elements
+      // avant de le relacher
+      vider(liste, 0);
+   } else {
+      COMPTER_RESTITUTIONS(liste->taille, 0);
+   }
+   free(liste);
+}
+
+bool relacherReservoir(ReservoirElements *reservoir) {
+   if (--reservoir->references) {
+      return false;
+   }
+   while (reservoir->blocs) {
+      Bloc *bloc = reservoir->blocs;
+      reservoir->blocs = bloc->suivant;
+      free(bloc);
+      COMPTER_RESTITUTIONS(0, 1);
+   }
+   free(reservoir);
+   return true;
+}
+
+Element *allouerElement(Liste *liste) {
+   ReservoirElements *reservoir = liste->reservoir;
+   if (!reservoir) {
+      return allouerElementSansReservoir();
+   }
+
+   Element *element;
+   if (reservoir->libres) {
+      // on recycle en priorité un element restitué
+      element = reservoir->libres;
+      reservoir->libres = element->suivant;
+   } else {
+      if (!reservoir->restantsDansBloc && !ajouterBloc(reservoir)) {
+         return NULL;
+      }
+      element = &reservoir->blocs->elements[reservoir->elementsParBloc -
+                                            reservoir->restantsDansBloc--];
+   }
+   COMPTER_ALLOCATIONS(1, 0);
+   // meme garantie que calloc
+   *element = (Element) {0};
+   return element;
+}
+
+bool ajouterBloc(ReservoirElements *reservoir) {
+   Bloc *bloc = (Bloc *) malloc(sizeof(Bloc) + reservoir->elementsParBloc *
+                                               sizeof(Element));
+   if (!bloc) {
+      return false;
+   }
+   COMPTER_ALLOCATIONS(0, 1);
+   bloc->suivant = reservoir->blocs;
+   reservoir->blocs = bloc;
+   reservoir->restantsDansBloc = reservoir->elementsParBloc;
+   return true;
+}
+
+Element *allouerElementsContigus(ReservoirElements *reservoir, size_t nombre) {
+   if (nombre > reservoir->restantsDansBloc &&
+       nombre <= reservoir->elementsParBloc) {
+      // les elements restants du bloc en cours ne sont pas perdus : ils
+      // rejoignent les elements libres
+      while (reservoir->restantsDansBloc) {
+         Element *element = &reservoir->blocs->elements[
+            reservoir->elementsParBloc - reservoir->restantsDansBloc--];
+         element->suivant = reservoir->libres;
+         reservoir->libres = element;
+      }
+      if (!ajouterBloc(reservoir)) {
+         return NULL;
+      }
+   }
+
+   if (nombre <= reservoir->restantsDansBloc) {
+      Element *elements = &reservoir->blocs->elements[reservoir->elementsParBloc -
+                                                      reservoir->restantsDansBloc];
+      reservoir->restantsDansBloc -= nombre;
+      return elements;
+   }
+
+   // plus d'elements qu'un bloc : bloc sur mesure, placé derriere le bloc en
+   // cours de découpage pour que celui-ci reste en tête
+   if (nombre > (SIZE_MAX - sizeof(Bloc)) / sizeof(Element)) {
+      return NULL;
+   }
+   Bloc *bloc = (Bloc *) malloc(sizeof(Bloc) + nombre * sizeof(Element));
+   if (!bloc) {
+      return NULL;
+   }
+   COMPTER_ALLOCATIONS(0, 1);
+   if (reservoir->blocs) {
+      bloc->suivant = reservoir->blocs->suivant;
+      reservoir->blocs->suivant = bloc;
+   } else {
+      bloc->suivant = NULL;
+      reservoir->blocs = bloc;
+   }
+   return bloc->elements;
+}
+
+Element *creerChaine(Liste *liste, const Info *tableau, size_t nombre,
+                     Element **fin) {
+   bool reservoirCree = false;
+   if (!liste->reservoir && estVide(liste)) {
+      // aucun element à restituer un par un : la liste peut passer à un
+      // reservoir privé
+      liste->reservoir = creerReservoir(0);
+      if (!liste->reservoir) {
+         return NULL;
+      }
+      reservoirCree = true;
+   }
+
+   if (liste->reservoir) {
+      Element *elements = allouerElementsContigus(liste->reservoir, nombre);
+      if (!elements) {
+         // la liste reste telle qu'avant l'appel : sans reservoir
+         if (reservoirCree) {
+            libererReservoir(liste->reservoir);
+            liste->reservoir = NULL;
+         }
+         return NULL;
+      }
+      COMPTER_ALLOCATIONS(nombre, 0);
+      for (size_t i = 0; i < nombre; i++) {
+         elements[i] = (Element) {
+            .info = tableau ? tableau[i] : 0,
+            .suivant = i + 1 < nombre ? &elements[i + 1] : NULL,
+            .precedent = i ? &elements[i - 1] : NULL
+         };
+      }
+      *fin = &elements[nombre - 1];
+      return elements;
+   }
+
+   // liste non vide sans reservoir : ses elements sont restitués un par un, ils
+   // doivent donc être alloués un par un
+   Element *debut = NULL;
+   Element *dernier = NULL;
+   for (size_t i = 0; i < nombre; i++) {
+      Element *element = allouerElement(liste);
+      if (!element) {
+         if (debut) {
+            COMPTER_RESTITUTIONS(i, 0);
+            libererChaine(liste, debut, dernier);
+         }
+         return NULL;
+      }
+      element->info = tableau ? tableau[i] : 0;
+      element->precedent = dernier;
+      if (dernier) {
+         dernier->suivant = element;
+      } else {
+         debut = element;
+      }
+      dernier = element;
+   }
+   *fin = dernier;
+   return debut;
+}
+
+void libererElement(Liste *liste, Element *element) {
+   if (liste->reservoir) {
+      COMPTER_RESTITUTIONS(1, 0);
+      element->suivant = liste->reservoir->libres;
+      liste->reservoir->libres = element;
+   } else {
+      COMPTER_RESTITUTIONS(1, 0);
+      libererElementSansReservoir(element);
+   }
+}
+
+void libererChaine(Liste *liste, Element *debut, Element *fin) {
+   if (liste->reservoir) {
+      // la chaine est deja liée par suivant, il suffit de l'accrocher devant les
+      // elements libres
+      fin->suivant = liste->reservoir->libres;
+      liste->reservoir->libres = debut;
+      return;
+   }
+   if (differerRestitution(debut, fin)) {
+      return;
+   }
+   while (debut) {
+      Element *tmp = debut;
+      debut = debut->suivant;
+      libererElementSansReservoir(tmp);
+   }
+}
+
 bool estVide(const Liste *liste) {
    return liste->tete == NULL;
 }
 
 size_t longueur(const Liste *liste) {
-   Element *elementActuel = liste->tete;
-   size_t taille = 0;
-
-   // tant qu'on un element dans la liste, on incrémente la taille
-   while (elementActuel) {
-      elementActuel = elementActuel->suivant;
-      taille++;
-   }
-   return taille;
+   INSTRUMENTER(LONGUEUR);
+   // la taille est tenue à jour par toutes les fonctions modifiant la liste
+   return liste->taille;
 }
 
 void afficher(const Liste *liste, Mode mode) {
+   afficherDans(stdout, liste, mode);
+}
 
+void formaterListe(TamponSortie *tampon, const Liste *liste, Mode mode) {
+   INSTRUMENTER(AFFICHER);
+   COMPTER_PARCOURUS(liste->taille);
    switch (mode) {
       case FORWARD:
-         afficherEnAvant(liste);
+         afficherEnAvant(tampon, liste);
          break;
       case BACKWARD:
-         afficherEnArriere(liste);
+         afficherEnArriere(tampon, liste);
          break;
       default:
          //on ne devrait jamais arriver ici.
@@ -106,10 +701,274 @@ void afficher(const Liste *liste, Mode mode) {
    }
 }
 
+Status activerIndexPositionnel(Liste *liste) {
+   INSTRUMENTER(ACTIVER_INDEX_POSITIONNEL);
+   if (liste->index) {
+      return OK;
+   }
+
+   size_t capacite = INDEX_CAPACITE_MINIMALE;
+   while (capacite < liste->taille) {
+      capacite *= 2;
+   }
+
+   IndexPositionnel *index = (IndexPositionnel *) calloc(1, sizeof(IndexPositionnel));
+   if (!index) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+   index->elements = (Element **) malloc(capacite * sizeof(Element *));
+   if (!index->elements) {
+      free(index);
+      return MEMOIRE_INSUFFISANTE;
+   }
+   index->capacite = capacite;
+   liste->index = index;
+   construireIndex(liste);
+   return OK;
+}
+
+void desactiverIndexPositionnel(Liste *liste) {
+   if (liste->index) {
+      free(liste->index->elements);
+      free(liste->index);
+      liste->index = NULL;
+   }
+}
+
+Status activerEmpreinte(Liste *liste) {
+   if (!liste->empreinte) {
+      // calloc : empreinte non valide, calculée à la premiere comparaison
+      liste->empreinte = (Empreinte *) calloc(1, sizeof(Empreinte));
+      if (!liste->empreinte) {
+         return MEMOIRE_INSUFFISANTE;
+      }
+   }
+   return OK;
+}
+
+void desactiverEmpreinte(Liste *liste) {
+   free(liste->empreinte);
+   liste->empreinte = NULL;
+}
+
+void invaliderEmpreinte(Liste *liste) {
+   if (liste->empreinte) {
+      liste->empreinte->valide = false;
+   }
+}
+
+Status activerRepertoireSegments(Liste *liste, size_t pas) {
+   INSTRUMENTER(ACTIVER_REPERTOIRE_SEGMENTS);
+   if (!liste->repertoire) {
+      // calloc : répertoire non valide, construit au premier traitement parallèle
+      liste->repertoire = (RepertoireSegments *) calloc(1, sizeof(RepertoireSegments));
+      if (!liste->repertoire) {
+         return MEMOIRE_INSUFFISANTE;
+      }
+   }
+   pas = pas ? pas : REPERTOIRE_PAS_PAR_DEFAUT;
+   if (liste->repertoire->pas != pas) {
+      liste->repertoire->pas = pas;
+      liste->repertoire->valide = false;
+   }
+   return OK;
+}
+
+void desactiverRepertoireSegments(Liste *liste) {
+   if (liste->repertoire) {
+      free(liste->repertoire->elements);
+      free(liste->repertoire);
+      liste->repertoire = NULL;
+   }
+}
+
+void invaliderRepertoire(Liste *liste) {
+   if (liste->repertoire) {
+      liste->repertoire->valide = false;
+   }
+}
+
+bool agrandirRepertoire(RepertoireSegments *repertoire, size_t nombre) {
+   if (nombre <= repertoire->capacite) {
+      return true;
+   }
+   size_t capacite = repertoire->capacite ? repertoire->capacite : 1;
+   while (capacite < nombre) {
+      capacite *= 2;
+   }
+   Element **elements =
+      (Element **) realloc(repertoire->elements, capacite * sizeof(Element *));
+   if (!elements) {
+      return false;
+   }
+   repertoire->elements = elements;
+   repertoire->capacite = capacite;
+   return true;
+}
+
+void repertorierEnQueue(Liste *liste, Element *debut, size_t nombre) {
+   RepertoireSegments *repertoire = liste->repertoire;
+   if (!repertoire || !repertoire->valide) {
+      return;
+   }
+   const size_t pas = repertoire->pas;
+   const size_t entrees = (liste->taille + nombre + pas - 1) / pas;
+   if (!agrandirRepertoire(repertoire, entrees)) {
+      repertoire->valide = false;
+      return;
+   }
+   // écart entre debut et la prochaine position multiple de pas
+   size_t ecart = repertoire->nombre * pas - liste->taille;
+   Element *element = debut;
+   while (repertoire->nombre < entrees) {
+      for (; ecart; ecart--) {
+         element = element->suivant;
+      }
+      repertoire->elements[repertoire->nombre++] = element;
+      ecart = pas;
+   }
+}
+
+void tronquerRepertoire(Liste *liste) {
+   RepertoireSegments *repertoire = liste->repertoire;
+   if (repertoire && repertoire->valide) {
+      size_t entrees = (liste->taille + repertoire->pas - 1) / repertoire->pas;
+      if (entrees < repertoire->nombre) {
+         repertoire->nombre = entrees;
+      }
+   }
+}
+
+bool actualiserRepertoire(const Liste *liste) {
+   RepertoireSegments *repertoire = liste->repertoire;
+   if (!repertoire) {
+      return false;
+   }
+   if (!repertoire->valide) {
+      if (!agrandirRepertoire(repertoire,
+                              (liste->taille + repertoire->pas - 1) / repertoire->pas)) {
+         return false;
+      }
+      COMPTER_PARCOURUS(liste->taille);
+      repertoire->nombre = 0;
+      size_t position = 0;
+      for (Element *element = liste->tete; element; element = element->suivant) {
+         if (position++ % repertoire->pas == 0) {
+            repertoire->elements[repertoire->nombre++] = element;
+         }
+      }
+      repertoire->valide = true;
+   }
+   return true;
+}
+
+uint64_t melangerInfo(Info info) {
+   // finaliseur de MurmurHash3
+   uint64_t x = (uint64_t) (unsigned) info;
+   x ^= x >> 33;
+   x *= 0xFF51AFD7ED558CCDu;
+   x ^= x >> 33;
+   x *= 0xC4CEB9FE1A85EC53u;
+   x ^= x >> 33;
+   return x;
+}
+
+void ajouterEmpreinteEnTete(Liste *liste, Info info) {
+   Empreinte *empreinte = liste->empreinte;
+   if (empreinte && empreinte->valide) {
+      // toutes les positions sont décalées d'une unité
+      empreinte->valeur = melangerInfo(info) + BASE_EMPREINTE * empreinte->valeur;
+      empreinte->puissance *= BASE_EMPREINTE;
+   }
+}
+
+void ajouterEmpreinteEnQueue(Liste *liste, Info info) {
+   Empreinte *empreinte = liste->empreinte;
+   if (empreinte && empreinte->valide) {
+      empreinte->valeur += melangerInfo(info) * empreinte->puissance;
+      empreinte->puissance *= BASE_EMPREINTE;
+   }
+}
+
+void retirerEmpreinteEnTete(Liste *liste, Info info) {
+   Empreinte *empreinte = liste->empreinte;
+   if (empreinte && empreinte->valide) {
+      empreinte->valeur = (empreinte->valeur - melangerInfo(info)) *
+                          BASE_EMPREINTE_INVERSE;
+      empreinte->puissance *= BASE_EMPREINTE_INVERSE;
+   }
+}
+
+void retirerEmpreinteEnQueue(Liste *liste, Info info) {
+   Empreinte *empreinte = liste->empreinte;
+   if (empreinte && empreinte->valide) {
+      empreinte->puissance *= BASE_EMPREINTE_INVERSE;
+      empreinte->valeur -= melangerInfo(info) * empreinte->puissance;
+   }
+}
+
+uint64_t valeurEmpreinte(const Liste *liste) {
+   Empreinte *empreinte = liste->empreinte;
+   if (!empreinte->valide) {
+      COMPTER_PARCOURUS(liste->taille);
+      empreinte->valeur = 0;
+      empreinte->puissance = 1;
+      for (const Element *element = liste->tete; element; element = element->suivant) {
+         empreinte->valeur += melangerInfo(element->info) * empreinte->puissance;
+         empreinte->puissance *= BASE_EMPREINTE;
+      }
+      empreinte->valide = true;
+   }
+   return empreinte->valeur;
+}
+
+void construireIndex(Liste *liste) {
+   IndexPositionnel *index = liste->index;
+   size_t position = 0;
+   index->debut = 0;
+   COMPTER_PARCOURUS(liste->taille);
+   for (Element *element = liste->tete; element; element = element->suivant) {
+      index->elements[position++] = element;
+   }
+}
+
+Status reserverIndex(Liste *liste, size_t nombre) {
+   IndexPositionnel *index = liste->index;
+   if (!index || nombre <= index->capacite - liste->taille) {
+      return OK;
+   }
+
+   size_t capacite = index->capacite;
+   while (capacite - liste->taille < nombre) {
+      if (capacite > SIZE_MAX / (2 * sizeof(Element *))) {
+         return MEMOIRE_INSUFFISANTE;
+      }
+      capacite *= 2;
+   }
+   Element **elements = (Element **) malloc(capacite * sizeof(Element *));
+   if (!elements) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+   // le tampon est "déroulé" : la position 0 se retrouve à l'indice 0
+   for (size_t i = 0; i < liste->taille; i++) {
+      elements[i] = index->elements[(index->debut + i) & (index->capacite - 1)];
+   }
+   free(index->elements);
+   index->elements = elements;
+   index->capacite = capacite;
+   index->debut = 0;
+   return OK;
+}
+
 Status insererEnTete(Liste *liste, const Info *info) {
-   // On utilise calloc pour avoir tous les elements de Element à 0
+   INSTRUMENTER(INSERER_EN_TETE);
+   if (reserverIndex(liste, 1) != OK) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+
+   // allouerElement garantit tous les elements de Element à 0
    // Pas besoin d'explicitement indiquer la valeur de precedent = NULL
-   Element *element = (Element *) calloc(1, sizeof(Element));
+   Element *element = allouerElement(liste);
    if (element) {
 
       if (info) {
@@ -127,6 +986,16 @@ Status insererEnTete(Liste *liste, const Info *info) {
       // Ce nouveau element devient la nouvelle tete de la liste
       liste->tete = element;
 
+      if (liste->index) {
+         // toutes les positions sont décalées : la position 0 recule d'une case
+         IndexPositionnel *index = liste->index;
+         index->debut = (index->debut - 1) & (index->capacite - 1);
+         index->elements[index->debut] = element;
+      }
+      ajouterEmpreinteEnTete(liste, element->info);
+      invaliderRepertoire(liste);
+      liste->taille++;
+
       //si on a pas encore une queue, il devient aussi la nouvelle queue de la liste
       if (!liste->queue) {
          liste->queue = element;
@@ -137,9 +1006,14 @@ Status insererEnTete(Liste *liste, const Info *info) {
 }
 
 Status insererEnQueue(Liste *liste, const Info *info) {
-   // On utilise calloc pour avoir tous les elements de Element à 0
+   INSTRUMENTER(INSERER_EN_QUEUE);
+   if (reserverIndex(liste, 1) != OK) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+
+   // allouerElement garantit tous les elements de Element à 0
    // Pas besoin d'explicitement indiquer la valeur de suivant = NULL
-   Element *element = (Element *) calloc(1, sizeof(Element));
+   Element *element = allouerElement(liste);
 
    if (element) {
       if (info) {
@@ -157,6 +1031,15 @@ Status insererEnQueue(Liste *liste, const Info *info) {
       // Ce nouveau element devient la nouvelle queue de la liste
       liste->queue = element;
 
+      if (liste->index) {
+         IndexPositionnel *index = liste->index;
+         index->elements[(index->debut + liste->taille) & (index->capacite - 1)] =
+            element;
+      }
+      ajouterEmpreinteEnQueue(liste, element->info);
+      repertorierEnQueue(liste, element, 1);
+      liste->taille++;
+
       //si on a pas encore une tete, il devient aussi la nouvelle tete de la liste
       if (!liste->tete) {
          liste->tete = element;
@@ -166,7 +1049,275 @@ Status insererEnQueue(Liste *liste, const Info *info) {
    return MEMOIRE_INSUFFISANTE;
 }
 
-void supprimerElement(Element *element, Info *info) {
+Status insererTableauEnQueue(Liste *liste, const Info *tableau, size_t nombre) {
+   INSTRUMENTER(INSERER_TABLEAU_EN_QUEUE);
+   if (!nombre) {
+      return OK;
+   }
+   Element *debut;
+   Element *fin;
+   if (reserverIndex(liste, nombre) != OK ||
+       !(debut = creerChaine(liste, tableau, nombre, &fin))) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+
+   debut->precedent = liste->queue;
+   if (liste->queue) {
+      liste->queue->suivant = debut;
+   } else {
+      liste->tete = debut;
+   }
+   liste->queue = fin;
+
+   if (liste->index) {
+      IndexPositionnel *index = liste->index;
+      size_t position = index->debut + liste->taille;
+      for (Element *element = debut; element; element = element->suivant) {
+         index->elements[position++ & (index->capacite - 1)] = element;
+      }
+   }
+   if (liste->empreinte) {
+      for (Element *element = debut; element; element = element->suivant) {
+         ajouterEmpreinteEnQueue(liste, element->info);
+      }
+   }
+   repertorierEnQueue(liste, debut, nombre);
+   liste->taille += nombre;
+   return OK;
+}
+
+Status insererTableauEnTete(Liste *liste, const Info *tableau, size_t nombre) {
+   INSTRUMENTER(INSERER_TABLEAU_EN_TETE);
+   if (!nombre) {
+      return OK;
+   }
+   Element *debut;
+   Element *fin;
+   if (reserverIndex(liste, nombre) != OK ||
+       !(debut = creerChaine(liste, tableau, nombre, &fin))) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+
+   fin->suivant = liste->tete;
+   if (liste->tete) {
+      liste->tete->precedent = fin;
+   } else {
+      liste->queue = fin;
+   }
+   liste->tete = debut;
+
+   if (liste->index) {
+      // la position 0 recule de nombre cases
+      IndexPositionnel *index = liste->index;
+      index->debut = (index->debut - nombre) & (index->capacite - 1);
+      size_t position = index->debut;
+      for (Element *element = debut; element != fin->suivant;
+           element = element->suivant) {
+         index->elements[position++ & (index->capacite - 1)] = element;
+      }
+   }
+   if (liste->empreinte) {
+      // de la derniere à la premiere info insérée, chacune devenant la tete
+      for (Element *element = fin; element; element = element->precedent) {
+         ajouterEmpreinteEnTete(liste, element->info);
+      }
+   }
+   invaliderRepertoire(liste);
+   liste->taille += nombre;
+   return OK;
+}
+
+size_t versTableau(const Liste *liste, Info *tableau, size_t capacite) {
+   INSTRUMENTER(VERS_TABLEAU);
+   size_t copies = 0;
+   for (const Element *element = liste->tete; element && copies < capacite;
+        element = element->suivant) {
+      tableau[copies++] = element->info;
+   }
+   COMPTER_PARCOURUS(copies);
+   return copies;
+}
+
+void detacherChaine(Liste *liste, Element *premier, Element *dernier,
+                    size_t position, size_t nombre) {
+   if (premier->precedent) {
+      premier->precedent->suivant = dernier->suivant;
+   } else {
+      liste->tete = dernier->suivant;
+   }
+   if (dernier->suivant) {
+      dernier->suivant->precedent = premier->precedent;
+   } else {
+      liste->queue = premier->precedent;
+   }
+   premier->precedent = NULL;
+   dernier->suivant = NULL;
+
+   // une chaine en queue ne décale aucune position, une chaine en tete les
+   // décale toutes de nombre
+   bool auMilieu = position && position + nombre < liste->taille;
+   bool enQueue = position + nombre == liste->taille;
+   liste->taille -= nombre;
+   if (liste->index) {
+      IndexPositionnel *index = liste->index;
+      if (!position) {
+         index->debut = (index->debut + nombre) & (index->capacite - 1);
+      } else if (auMilieu) {
+         construireIndex(liste);
+      }
+   }
+   invaliderEmpreinte(liste);
+   if (enQueue) {
+      tronquerRepertoire(liste);
+   } else {
+      invaliderRepertoire(liste);
+   }
+}
+
+void insererChaine(Liste *liste, Element *precedent, Element *premier,
+                   Element *dernier, size_t nombre) {
+   Element *suivant = precedent ? precedent->suivant : liste->tete;
+   premier->precedent = precedent;
+   dernier->suivant = suivant;
+   if (precedent) {
+      precedent->suivant = premier;
+   } else {
+      liste->tete = premier;
+   }
+   if (suivant) {
+      suivant->precedent = dernier;
+   } else {
+      liste->queue = dernier;
+   }
+
+   if (suivant) {
+      invaliderRepertoire(liste);
+   } else {
+      repertorierEnQueue(liste, premier, nombre);
+   }
+   IndexPositionnel *index = liste->index;
+   if (index && (!suivant || !precedent)) {
+      // en queue, les positions suivent celles de la liste ; en tete, la
+      // position 0 recule de nombre cases
+      if (suivant) {
+         index->debut = (index->debut - nombre) & (index->capacite - 1);
+      }
+      size_t position = suivant ? index->debut : index->debut + liste->taille;
+      for (Element *element = premier; element != suivant; element = element->suivant) {
+         index->elements[position++ & (index->capacite - 1)] = element;
+      }
+   }
+   liste->taille += nombre;
+   if (index && suivant && precedent) {
+      construireIndex(liste);
+   }
+   invaliderEmpreinte(liste);
+}
+
+Status deplacerChaine(Liste *destination, Element *precedent, Liste *source,
+                      Element *premier, Element *dernier, size_t position,
+                      size_t nombre) {
+   if (reserverIndex(destination, nombre) != OK) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+   // un element ne peut être restitué qu'au reservoir (ou à free) qui l'a
+   // alloué : d'une liste à une autre allouant autrement, il faut recopier
+   Element *copie = NULL;
+   Element *finCopie = NULL;
+   if (destination->reservoir != source->reservoir) {
+      copie = creerChaine(destination, NULL, nombre, &finCopie);
+      if (!copie) {
+         return MEMOIRE_INSUFFISANTE;
+      }
+      COMPTER_PARCOURUS(nombre);
+      for (Element *element = premier, *copieActuelle = copie; copieActuelle;
+           element = element->suivant, copieActuelle = copieActuelle->suivant) {
+         copieActuelle->info = element->info;
+      }
+   }
+
+   detacherChaine(source, premier, dernier, position, nombre);
+   if (copie) {
+      COMPTER_RESTITUTIONS(nombre, 0);
+      libererChaine(source, premier, dernier);
+      premier = copie;
+      dernier = finCopie;
+   }
+   insererChaine(destination, precedent, premier, dernier, nombre);
+   return OK;
+}
+
+Status concatener(Liste *destination, Liste *source) {
+   INSTRUMENTER(CONCATENER);
+   if (destination == source || estVide(source)) {
+      return OK;
+   }
+   // deux empreintes valides se combinent en O(1) : les positions de source sont
+   // décalées de la longueur de destination
+   Empreinte combinee = {0};
+   if (destination->empreinte && destination->empreinte->valide &&
+       source->empreinte && source->empreinte->valide) {
+      combinee.valeur = destination->empreinte->valeur +
+                        source->empreinte->valeur * destination->empreinte->puissance;
+      combinee.puissance = destination->empreinte->puissance *
+                           source->empreinte->puissance;
+      combinee.valide = true;
+   }
+
+   Status status = deplacerChaine(destination, destination->queue, source,
+                                  source->tete, source->queue, 0, source->taille);
+   if (status == OK && combinee.valide) {
+      *destination->empreinte = combinee;
+   }
+   return status;
+}
+
+Liste *couperA(Liste *liste, size_t position) {
+   INSTRUMENTER(COUPER_A);
+   if (position > liste->taille) {
+      return NULL;
+   }
+   Liste *nouvelle = initialiser();
+   if (!nouvelle) {
+      return NULL;
+   }
+   // même reservoir et pas d'index : le déplacement n'alloue rien
+   if (liste->reservoir) {
+      nouvelle->reservoir = liste->reservoir;
+      liste->reservoir->references++;
+   }
+   if (position < liste->taille) {
+      Element *premier;
+      getElement(liste, position, &premier);
+      deplacerChaine(nouvelle, NULL, liste, premier, liste->queue, position,
+                     liste->taille - position);
+   }
+   return nouvelle;
+}
+
+Status transfererPlage(Liste *destination, size_t position, Liste *source,
+                       size_t debut, size_t nombre) {
+   INSTRUMENTER(TRANSFERER_PLAGE);
+   if (destination == source || debut > source->taille ||
+       nombre > source->taille - debut || position > destination->taille) {
+      return POSITION_NON_VALIDE;
+   }
+   if (!nombre) {
+      return OK;
+   }
+   Element *premier = NULL;
+   Element *dernier = NULL;
+   Element *precedent = NULL;
+   getElement(source, debut, &premier);
+   getElement(source, debut + nombre - 1, &dernier);
+   if (position) {
+      getElement(destination, position - 1, &precedent);
+   }
+   return deplacerChaine(destination, precedent, source, premier, dernier, debut,
+                         nombre);
+}
+
+void supprimerElement(Liste *liste, Element *element, Info *info) {
 
    if (!element) {
       return;
@@ -187,10 +1338,11 @@ void supprimerElement(Element *element, Info *info) {
    }
 
    // restituer mémoire
-   free(element);
+   libererElement(liste, element);
 }
 
 Status supprimerEnTete(Liste *liste, Info *info) {
+   INSTRUMENTER(SUPPRIMER_EN_TETE);
    // verifier si la liste est vide avant de faire quoi que ce soit
    if (estVide(liste)) {
       return LISTE_VIDE;
@@ -207,13 +1359,21 @@ Status supprimerEnTete(Liste *liste, Info *info) {
       liste->queue = NULL;
    }
 
+   if (liste->index) {
+      liste->index->debut = (liste->index->debut + 1) & (liste->index->capacite - 1);
+   }
+   retirerEmpreinteEnTete(liste, tete->info);
+   invaliderRepertoire(liste);
+   liste->taille--;
+
    // supprimer l'ancienne tete
-   supprimerElement(tete, info);
+   supprimerElement(liste, tete, info);
 
    return OK;
 }
 
 Status supprimerEnQueue(Liste *liste, Info *info) {
+   INSTRUMENTER(SUPPRIMER_EN_QUEUE);
    // verifier si la liste est vide avant de faire quoi que ce soit
    if (estVide(liste)) {
       return LISTE_VIDE;
@@ -228,47 +1388,169 @@ Status supprimerEnQueue(Liste *liste, Info *info) {
    if (!liste->queue) {
       liste->tete = NULL;
    }
+   retirerEmpreinteEnQueue(liste, queue->info);
+   liste->taille--;
+   tronquerRepertoire(liste);
    // supprimer l'ancienne queue
-   supprimerElement(queue, info);
+   supprimerElement(liste, queue, info);
 
    return OK;
 }
 
 void supprimerSelonCritere(Liste *liste,
                            bool (*critere)(size_t position, const Info *info)) {
+   INSTRUMENTER(SUPPRIMER_SELON_CRITERE);
    // verifier les parametres d'entree
    if (!critere || estVide(liste)) {
       return;
    }
    size_t position = 0;
    Element *elementActuel = liste->tete;
+   IndexPositionnel *index = liste->index;
+   // nombre d'elements conservés, qui sont recopiés au fur et à mesure au debut
+   // de l'index s'il existe
+   size_t conserves = 0;
+   // elements supprimés, chaînés via suivant pour être restitués en une fois
+   Element *debutSupprimes = NULL;
+   Element *finSupprimes = NULL;
 
    //iterer sur la liste et verifier le critere pour chacun des elements
    while (elementActuel) {
+      Element *suivant = elementActuel->suivant;
       if (critere(position, &elementActuel->info)) {
          //critere ok, on supprime l'element
-         // verifier si c'est la tete ou la queue
+         // verifier si c'est la tete et/ou la queue
          if (elementActuel == liste->tete) {
-            supprimerEnTete(liste, NULL);
-            elementActuel = liste->tete;
-         } else if (elementActuel == liste->queue) {
-            supprimerEnQueue(liste, NULL);
-            elementActuel = NULL;
+            liste->tete = suivant;
+         }
+         if (elementActuel == liste->queue) {
+            liste->queue = elementActuel->precedent;
+         }
+         if (elementActuel->precedent) {
+            elementActuel->precedent->suivant = suivant;
+         }
+         if (suivant) {
+            suivant->precedent = elementActuel->precedent;
+         }
+         if (finSupprimes) {
+            finSupprimes->suivant = elementActuel;
          } else {
-            // pas besoin de verifier si suivant existe car on serait en train de
-            // supprimer la queue si c'etait le cas
-            elementActuel = elementActuel->suivant;
-            supprimerElement(elementActuel->precedent, NULL);
+            debutSupprimes = elementActuel;
          }
+         finSupprimes = elementActuel;
       } else {
-         // on passe au prochain element
-         elementActuel = elementActuel->suivant;
+         if (index) {
+            index->elements[(index->debut + conserves) & (index->capacite - 1)] =
+               elementActuel;
+         }
+         conserves++;
       }
+      // on passe au prochain element
+      elementActuel = suivant;
       position++;
    }
+   COMPTER_PARCOURUS(position);
+
+   if (debutSupprimes) {
+      finSupprimes->suivant = NULL;
+      COMPTER_RESTITUTIONS(liste->taille - conserves, 0);
+      libererChaine(liste, debutSupprimes, finSupprimes);
+   }
+   if (conserves != liste->taille) {
+      invaliderEmpreinte(liste);
+      invaliderRepertoire(liste);
+   }
+   liste->taille = conserves;
+}
+
+void supprimerSelonCritereParLot(Liste *liste,
+                                 void (*critere)(size_t positionDebut,
+                                                 const Info *infos, size_t nombre,
+                                                 bool *aSupprimer)) {
+   INSTRUMENTER(SUPPRIMER_SELON_CRITERE_PAR_LOT);
+   // verifier les parametres d'entree
+   if (!critere || estVide(liste)) {
+      return;
+   }
+   Element *elements[TAILLE_LOT_CRITERE];
+   Info infos[TAILLE_LOT_CRITERE];
+   bool aSupprimer[TAILLE_LOT_CRITERE];
+
+   IndexPositionnel *index = liste->index;
+   Element *elementActuel = liste->tete;
+   // dernier element conservé, auquel on raccroche les suivants conservés
+   Element *dernierConserve = NULL;
+   size_t position = 0;
+   size_t conserves = 0;
+
+   liste->tete = NULL;
+   while (elementActuel) {
+      // copier un lot d'infos consécutives dans un tableau contigu
+      size_t nombre = 0;
+      while (elementActuel && nombre < TAILLE_LOT_CRITERE) {
+         elements[nombre] = elementActuel;
+         infos[nombre++] = elementActuel->info;
+         elementActuel = elementActuel->suivant;
+      }
+
+      critere(position, infos, nombre, aSupprimer);
+
+      // une seule passe sur le masque pour rechainer les elements conservés.
+      // Les elements supprimés du lot sont chaînés via suivant pour être
+      // restitués en une fois, tant qu'ils sont encore en cache.
+      Element *debutSupprimes = NULL;
+      Element *finSupprimes = NULL;
+      for (size_t i = 0; i < nombre; i++) {
+         Element *element = elements[i];
+         if (aSupprimer[i]) {
+            COMPTER_RESTITUTIONS(1, 0);
+            if (finSupprimes) {
+               finSupprimes->suivant = element;
+            } else {
+               debutSupprimes = element;
+            }
+            finSupprimes = element;
+            continue;
+         }
+         // on n'ecrit que les liens qui changent : un element dont les voisins
+         // sont conservés n'est pas modifié
+         if (element->precedent != dernierConserve) {
+            element->precedent = dernierConserve;
+            if (dernierConserve) {
+               dernierConserve->suivant = element;
+            }
+         }
+         if (!dernierConserve) {
+            liste->tete = element;
+         }
+         dernierConserve = element;
+         if (index) {
+            index->elements[(index->debut + conserves) & (index->capacite - 1)] =
+               element;
+         }
+         conserves++;
+      }
+      if (debutSupprimes) {
+         finSupprimes->suivant = NULL;
+         libererChaine(liste, debutSupprimes, finSupprimes);
+      }
+      position += nombre;
+   }
+   COMPTER_PARCOURUS(position);
+
+   if (dernierConserve) {
+      dernierConserve->suivant = NULL;
+   }
+   liste->queue = dernierConserve;
+   if (conserves != liste->taille) {
+      invaliderEmpreinte(liste);
+      invaliderRepertoire(liste);
+   }
+   liste->taille = conserves;
 }
 
 void vider(Liste *liste, size_t position) {
+   INSTRUMENTER(VIDER);
    Element *elementActuel;
    Status status = getElement(liste, position, &elementActuel);
    if (status == POSITION_NON_VALIDE) {
@@ -277,6 +1559,7 @@ void vider(Liste *liste, size_t position) {
 
    //Pour vider la liste, on fait la queue pointer sur l'element precedent
    // a l'element a la position position et on libere ensuite la memoire elements.
+   Element *queue = liste->queue;
    liste->queue = elementActuel->precedent;
 
 
@@ -290,31 +1573,52 @@ void vider(Liste *liste, size_t position) {
       liste->queue->suivant = NULL;
    }
 
+   invaliderEmpreinte(liste);
+   COMPTER_RESTITUTIONS(liste->taille - position, 0);
+   liste->taille = position;
+   tronquerRepertoire(liste);
+
    // Liste a jour, il suffit de restituer la memoire
-   while (elementActuel) {
-      Element *tmp = elementActuel;
-      elementActuel = elementActuel->suivant;
-      free(tmp);
-   }
+   libererChaine(liste, elementActuel, queue);
 }
 
-static Status getElement(const Liste *liste, size_t position, Element **element) {
-   if (estVide(liste)) {
+Status elementA(const Liste *liste, size_t position, Info *info) {
+   INSTRUMENTER(ELEMENT_A);
+   Element *element;
+   if (getElement(liste, position, &element) != OK) {
       return POSITION_NON_VALIDE;
    }
-
-   Element *elementActuel = liste->tete;
-
-   // on itere sur notre liste tant que on a un element valable
-   // en decrementant la position
-   while (elementActuel && position--) {
-      elementActuel = elementActuel->suivant;
+   if (info) {
+      *info = element->info;
    }
+   return OK;
+}
 
-   if (!elementActuel) {
+Status getElement(const Liste *liste, size_t position, Element **element) {
+   if (position >= liste->taille) {
       return POSITION_NON_VALIDE;
    }
 
+   const IndexPositionnel *index = liste->index;
+   Element *elementActuel;
+   if (index) {
+      elementActuel = index->elements[(index->debut + position) & (index->capacite - 1)];
+   } else if (position < liste->taille / 2) {
+      // on itere depuis la tete en decrementant la position
+      elementActuel = liste->tete;
+      COMPTER_PARCOURUS(position);
+      while (position--) {
+         elementActuel = elementActuel->suivant;
+      }
+   } else {
+      // la position est plus proche de la queue : on remonte depuis celle-ci
+      elementActuel = liste->queue;
+      COMPTER_PARCOURUS(liste->taille - 1 - position);
+      for (position = liste->taille - 1 - position; position; position--) {
+         elementActuel = elementActuel->precedent;
+      }
+   }
+
    if (element) {
       *element = elementActuel;
    }
@@ -322,11 +1626,24 @@ static Status getElement(const Liste *liste, size_t position, Element **element)
 }
 
 bool sontEgales(const Liste *liste1, const Liste *liste2) {
+   INSTRUMENTER(SONT_EGALES);
+   // des listes de longueurs différentes ne peuvent pas être égales
+   if (liste1->taille != liste2->taille) {
+      return false;
+   }
+   // des empreintes différentes garantissent des contenus différents ; des
+   // empreintes égales doivent être confirmées par le parcours
+   if (liste1->empreinte && liste2->empreinte &&
+       valeurEmpreinte(liste1) != valeurEmpreinte(liste2)) {
+      return false;
+   }
+
    Element *elementActuelL1 = liste1->tete;
    Element *elementActuelL2 = liste2->tete;
 
    // itérer tant qu'on a des pointeurs valables
    while (elementActuelL1 && elementActuelL2) {
+      COMPTER_PARCOURUS(1);
       if (elementActuelL1->info != elementActuelL2->info) {
          return false;
       }
@@ -337,3 +1654,245 @@ bool sontEgales(const Liste *liste1, const Liste *liste2) {
    // sont égales
    return elementActuelL1 == NULL && elementActuelL2 == NULL;
 }
+
+void trier(Liste *liste, int (*comparer)(const Info *info1, const Info *info2)) {
+   INSTRUMENTER(TRIER);
+   if (liste->taille < 2) {
+      return;
+   }
+   // les infos entieres sont comparées directement, sans appel de fonction
+   if (comparer) {
+      trierInfosParComparateur(liste, comparer);
+   } else {
+      trierInfosParValeur(liste, NULL);
+   }
+
+   // les precedent ont servi de tampon : on les recalcule
+   COMPTER_PARCOURUS(liste->taille);
+   Element *precedent = NULL;
+   for (Element *element = liste->tete; element; element = element->suivant) {
+      element->precedent = precedent;
+      precedent = element;
+   }
+   invaliderEmpreinte(liste);
+}
+
+Status compacter(Liste *liste) {
+   INSTRUMENTER(COMPACTER);
+   if (estVide(liste)) {
+      return OK;
+   }
+   // un reservoir dont la liste est la seule utilisatrice est remplacé par un
+   // neuf : tous ses blocs pourront être restitués d'un coup
+   ReservoirElements *ancien = liste->reservoir;
+   const bool prive = !ancien || ancien->references == 1;
+   ReservoirElements *reservoir =
+      prive ? creerReservoir(ancien ? ancien->elementsParBloc : 0) : ancien;
+   if (!reservoir) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+   const size_t taille = liste->taille;
+   Element *elements = allouerElementsContigus(reservoir, taille);
+   if (!elements) {
+      if (prive) {
+         relacherReservoir(reservoir);
+      }
+      return MEMOIRE_INSUFFISANTE;
+   }
+   COMPTER_ALLOCATIONS(taille, 0);
+
+   // recopie dans l'ordre de parcours : les elements se suivent en mémoire
+   COMPTER_PARCOURUS(taille);
+   size_t i = 0;
+   for (Element *element = liste->tete; element; element = element->suivant) {
+      elements[i] = (Element) {
+         .info = element->info,
+         .suivant = i + 1 < taille ? &elements[i + 1] : NULL,
+         .precedent = i ? &elements[i - 1] : NULL
+      };
+      i++;
+   }
+
+   // restitution des anciens elements, selon leur provenance
+   COMPTER_RESTITUTIONS(taille, 0);
+   if (ancien && prive) {
+      relacherReservoir(ancien);
+   } else {
+      libererChaine(liste, liste->tete, liste->queue);
+   }
+   liste->reservoir = reservoir;
+   liste->tete = elements;
+   liste->queue = &elements[taille - 1];
+   if (liste->index) {
+      construireIndex(liste);
+   }
+   invaliderRepertoire(liste);
+   return OK;
+}
+
+Curseur curseurEnTete(Liste *liste) {
+   return (Curseur) {liste, liste->tete, 0};
+}
+
+Curseur curseurEnQueue(Liste *liste) {
+   return (Curseur) {liste, liste->queue, liste->taille ? liste->taille - 1 : 0};
+}
+
+bool estDansListe(const Curseur *curseur) {
+   return curseur->element != NULL;
+}
+
+Status avancerCurseur(Curseur *curseur) {
+   if (!curseur->element) {
+      return POSITION_NON_VALIDE;
+   }
+   curseur->element = curseur->element->suivant;
+   curseur->position++;
+   return curseur->element ? OK : POSITION_NON_VALIDE;
+}
+
+Status reculerCurseur(Curseur *curseur) {
+   if (!curseur->element) {
+      return POSITION_NON_VALIDE;
+   }
+   curseur->element = curseur->element->precedent;
+   // hors de la liste, la position n'a plus de sens : on évite de passer sous 0
+   if (curseur->element) {
+      curseur->position--;
+   }
+   return curseur->element ? OK : POSITION_NON_VALIDE;
+}
+
+Status infoCurseur(const Curseur *curseur, Info *info) {
+   if (!curseur->element) {
+      return POSITION_NON_VALIDE;
+   }
+   if (info) {
+      *info = curseur->element->info;
+   }
+   return OK;
+}
+
+void insererDansIndex(Liste *liste, size_t position, Element *element) {
+   IndexPositionnel *index = liste->index;
+   if (!index) {
+      return;
+   }
+   size_t masque = index->capacite - 1;
+   if (position < liste->taille - position) {
+      // les elements avant position reculent d'une case
+      COMPTER_PARCOURUS(position);
+      index->debut = (index->debut - 1) & masque;
+      for (size_t i = 0; i < position; i++) {
+         index->elements[(index->debut + i) & masque] =
+            index->elements[(index->debut + i + 1) & masque];
+      }
+   } else {
+      // les elements à partir de position avancent d'une case
+      COMPTER_PARCOURUS(liste->taille - position);
+      for (size_t i = liste->taille; i > position; i--) {
+         index->elements[(index->debut + i) & masque] =
+            index->elements[(index->debut + i - 1) & masque];
+      }
+   }
+   index->elements[(index->debut + position) & masque] = element;
+}
+
+void retirerDeIndex(Liste *liste, size_t position) {
+   IndexPositionnel *index = liste->index;
+   if (!index) {
+      return;
+   }
+   size_t masque = index->capacite - 1;
+   if (position < liste->taille - 1 - position) {
+      // les elements avant position avancent d'une case
+      COMPTER_PARCOURUS(position);
+      for (size_t i = position; i > 0; i--) {
+         index->elements[(index->debut + i) & masque] =
+            index->elements[(index->debut + i - 1) & masque];
+      }
+      index->debut = (index->debut + 1) & masque;
+   } else {
+      // les elements après position reculent d'une case
+      COMPTER_PARCOURUS(liste->taille - 1 - position);
+      for (size_t i = position; i + 1 < liste->taille; i++) {
+         index->elements[(index->debut + i) & masque] =
+            index->elements[(index->debut + i + 1) & masque];
+      }
+   }
+}
+
+Status insererEntre(Liste *liste, Element *precedent, size_t position,
+                    const Info *info) {
+   if (reserverIndex(liste, 1) != OK) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+   Element *element = allouerElement(liste);
+   if (!element) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+   if (info) {
+      element->info = *info;
+   }
+   element->precedent = precedent;
+   element->suivant = precedent->suivant;
+   precedent->suivant->precedent = element;
+   precedent->suivant = element;
+
+   insererDansIndex(liste, position, element);
+   invaliderEmpreinte(liste);
+   invaliderRepertoire(liste);
+   liste->taille++;
+   return OK;
+}
+
+Status insererAvantCurseur(Curseur *curseur, const Info *info) {
+   INSTRUMENTER(INSERER_AVANT_CURSEUR);
+   Element *element = curseur->element;
+   if (!element) {
+      return POSITION_NON_VALIDE;
+   }
+   // en tete, insererEnTete tient l'index et l'empreinte à jour en O(1)
+   Status status = element->precedent
+                   ? insererEntre(curseur->liste, element->precedent,
+                                  curseur->position, info)
+                   : insererEnTete(curseur->liste, info);
+   if (status == OK) {
+      curseur->position++;
+   }
+   return status;
+}
+
+Status insererApresCurseur(Curseur *curseur, const Info *info) {
+   INSTRUMENTER(INSERER_APRES_CURSEUR);
+   Element *element = curseur->element;
+   if (!element) {
+      return POSITION_NON_VALIDE;
+   }
+   return element->suivant
+          ? insererEntre(curseur->liste, element, curseur->position + 1, info)
+          : insererEnQueue(curseur->liste, info);
+}
+
+Status supprimerCurseur(Curseur *curseur, Info *info) {
+   INSTRUMENTER(SUPPRIMER_CURSEUR);
+   Element *element = curseur->element;
+   if (!element) {
+      return POSITION_NON_VALIDE;
+   }
+   Liste *liste = curseur->liste;
+   curseur->element = element->suivant;
+
+   if (!element->precedent) {
+      return supprimerEnTete(liste, info);
+   }
+   if (!element->suivant) {
+      return supprimerEnQueue(liste, info);
+   }
+   retirerDeIndex(liste, curseur->position);
+   invaliderEmpreinte(liste);
+   invaliderRepertoire(liste);
+   liste->taille--;
+   supprimerElement(liste, element, info);
+   return OK;
+}
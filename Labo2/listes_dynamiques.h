@@ -18,10 +18,14 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdio.h>
 
 // Pour la gestion des "exceptions"
+// ERREUR_FICHIER et FORMAT_NON_VALIDE ne sont renvoyés que par les fonctions de
+// persistance.h
 typedef enum {
-   OK, MEMOIRE_INSUFFISANTE, LISTE_VIDE, POSITION_NON_VALIDE
+   OK, MEMOIRE_INSUFFISANTE, LISTE_VIDE, POSITION_NON_VALIDE, ERREUR_FICHIER,
+   FORMAT_NON_VALIDE
 } Status;
 
 // Modes d'affichage possibles de la liste
@@ -33,17 +37,71 @@ typedef enum {
 
 typedef int Info;
 
+#ifdef LISTES_DEROULEES
+
+// Nombre d'infos stockées par element d'une liste déroulée (un element occupe
+// alors 128 octets)
+#define INFOS_PAR_ELEMENT 26
+
+// Liste déroulée : chaque element stocke, de manière contiguë, les infos
+// infos[debut] à infos[debut + nombre - 1]. Un element n'est jamais vide.
+typedef struct element {
+   struct element *suivant;
+   struct element *precedent;
+   unsigned debut;
+   unsigned nombre;
+   Info infos[INFOS_PAR_ELEMENT];
+} Element;
+
+typedef struct {
+   Element *tete;
+   Element *queue;
+   size_t taille;                // nombre d'infos de la liste
+} Liste;
+
+#else
+
 typedef struct element {
    Info info;
    struct element *suivant;
    struct element *precedent;
 } Element;
 
+// Réservoir d'éléments : alloue les éléments par blocs et recycle les éléments
+// libérés. Un réservoir peut être partagé par plusieurs listes.
+typedef struct reservoir ReservoirElements;
+
+// Index positionnel : permet d'atteindre l'element à une position donnée en O(1)
+typedef struct indexPositionnel IndexPositionnel;
+
+// Empreinte : hachage du contenu de la liste permettant à sontEgales de rejeter
+// en O(1) la plupart des listes différentes
+typedef struct empreinte Empreinte;
+
+// Répertoire de segments : un element sur pas, permettant de découper la liste
+// en segments sans la parcourir
+typedef struct repertoireSegments RepertoireSegments;
+
 typedef struct {
    Element *tete;
    Element *queue;
+   size_t taille;                // nombre d'éléments de la liste
+   ReservoirElements *reservoir; // NULL : éléments alloués un à un (calloc/free)
+   IndexPositionnel *index;      // NULL : pas d'index positionnel
+   Empreinte *empreinte;         // NULL : pas d'empreinte
+   RepertoireSegments *repertoire; // NULL : pas de répertoire de segments
 } Liste;
 
+// Curseur : désigne un élément d'une liste (ou aucun, une fois sorti de la
+// liste) et permet de la modifier à cet endroit sans la reparcourir.
+typedef struct {
+   Liste *liste;
+   Element *element;             // NULL : curseur hors de la liste
+   size_t position;              // position de element dans liste
+} Curseur;
+
+#endif
+
 // ------------------------------------------------------------------------------
 // Initialisation de la liste.
 // N.B. Cette fonction doit obligatoirement être utilisée pour se créer une liste
@@ -59,6 +117,8 @@ bool estVide(const Liste *liste);
 
 // ------------------------------------------------------------------------------
 // Renvoie combien il y a d'éléments dans liste.
+// N.B. En O(1) : le nombre d'éléments est tenu à jour par toutes les fonctions
+// modifiant liste.
 size_t longueur(const Liste *liste);
 // ------------------------------------------------------------------------------
 
@@ -70,6 +130,23 @@ size_t longueur(const Liste *liste);
 void afficher(const Liste *liste, Mode mode);
 // ------------------------------------------------------------------------------
 
+// ------------------------------------------------------------------------------
+// Écrit dans flux le contenu intégral de liste, au même format que afficher.
+// N.B. Le texte est produit dans un tampon et écrit par blocs (un seul fwrite
+// pour une liste courte).
+void afficherDans(FILE *flux, const Liste *liste, Mode mode);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Écrit dans chaine (terminée par '\0') le contenu intégral de liste, au même
+// format que afficher. Au plus capacite caractères, '\0' compris, sont écrits :
+// le texte est tronqué s'il ne tient pas.
+// Renvoie la longueur du texte complet (sans le '\0'), comme snprintf ; le texte
+// a été tronqué si elle est supérieure ou égale à capacite.
+size_t formaterDansTampon(char *chaine, size_t capacite, const Liste *liste,
+                          Mode mode);
+// ------------------------------------------------------------------------------
+
 // ------------------------------------------------------------------------------
 // Insère un nouvel élément (contenant info) en tête de liste.
 // Renvoie OK si l'insertion s'est déroulée avec succès et MEMOIRE_INSUFFISANTE
@@ -117,8 +194,294 @@ void vider(Liste *liste, size_t position);
 // ------------------------------------------------------------------------------
 // Renvoie true si liste1 et liste2 sont égales (au sens mêmes infos et infos
 // apparaissant dans le même ordre), false sinon.
-// N.B. 2 listes vides sont considérées comme égales.
+// N.B. 2 listes vides sont considérées comme égales. Des listes de longueurs
+// différentes sont rejetées en O(1), de même que des listes dont les empreintes
+// diffèrent (cf. activerEmpreinte).
 bool sontEgales(const Liste *liste1, const Liste *liste2);
 // ------------------------------------------------------------------------------
 
+// ------------------------------------------------------------------------------
+// Renvoie, via le paramètre info, l'info stockée dans l'élément à la position
+// position de liste (la tête est à la position 0).
+// Renvoie POSITION_NON_VALIDE si liste ne contient pas de position position, OK
+// sinon.
+// N.B. En O(1) si liste dispose d'un index positionnel
+// (cf. activerIndexPositionnel), en O(n) sinon, le parcours partant de
+// l'extrémité la plus proche de position.
+Status elementA(const Liste *liste, size_t position, Info *info);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Supprime, en restituant la mémoire allouée, tous les éléments de liste puis
+// restitue la liste elle-même.
+void detruire(Liste *liste);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Insère en queue de liste les nombre infos de tableau, dans l'ordre : la
+// dernière info de tableau devient la queue. Si tableau vaut NULL, les nombre
+// infos insérées valent 0.
+// Renvoie OK si l'insertion s'est déroulée avec succès et MEMOIRE_INSUFFISANTE
+// sinon ; la liste n'est alors pas modifiée.
+// N.B. Sans LISTES_DEROULEES, les nombre éléments sont alloués de manière
+// contiguë (en une seule allocation) dans le réservoir de liste. Une liste vide
+// sans réservoir se voit attribuer un réservoir privé (cf.
+// initialiserAvecReservoir) ; une liste non vide sans réservoir alloue ses
+// éléments un à un.
+Status insererTableauEnQueue(Liste *liste, const Info *tableau, size_t nombre);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Insère en tête de liste les nombre infos de tableau, dans l'ordre : la
+// première info de tableau devient la tête. Mêmes remarques que
+// insererTableauEnQueue.
+Status insererTableauEnTete(Liste *liste, const Info *tableau, size_t nombre);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Copie dans tableau, de la tête vers la queue, les infos de liste, au plus
+// capacite.
+// Renvoie le nombre d'infos copiées (le minimum de capacite et de la longueur
+// de liste).
+size_t versTableau(const Liste *liste, Info *tableau, size_t capacite);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Déplace tous les éléments de source en queue de destination, dans l'ordre ;
+// source devient vide.
+// Renvoie OK si le déplacement s'est déroulé avec succès et MEMOIRE_INSUFFISANTE
+// sinon ; les listes ne sont alors pas modifiées.
+// N.B. En O(1) : les éléments sont rechaînés sans être copiés ni alloués. Sans
+// LISTES_DEROULEES, ce n'est possible que si les deux listes utilisent le même
+// réservoir (ou aucune) ; les éléments sont sinon recopiés dans des éléments de
+// destination. Un index positionnel de destination est complété en O(longueur
+// de source).
+Status concatener(Liste *destination, Liste *source);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Coupe liste avant la position position : les éléments à partir de position
+// sont déplacés, sans copie, dans une nouvelle liste renvoyée, liste ne gardant
+// que les position premiers.
+// Renvoie NULL si position est supérieure à la longueur de liste ou en cas de
+// mémoire insuffisante ; liste n'est alors pas modifiée.
+// N.B. La recherche de position parcourt liste depuis l'extrémité la plus
+// proche, sauf si liste dispose d'un index positionnel. Sans LISTES_DEROULEES, la nouvelle liste
+// partage le réservoir de liste ; elle n'a ni index ni empreinte. Avec
+// LISTES_DEROULEES, un élément est alloué si position tombe au milieu d'un
+// élément.
+Liste *couperA(Liste *liste, size_t position);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Déplace les nombre éléments de source à partir de la position debut dans
+// destination, où le premier d'entre eux se retrouve à la position position.
+// Renvoie OK si le déplacement s'est déroulé avec succès, POSITION_NON_VALIDE si
+// source n'a pas nombre éléments à partir de debut, si position est supérieure à
+// la longueur de destination ou si destination et source sont la même liste, et
+// MEMOIRE_INSUFFISANTE sinon ; les listes ne sont alors pas modifiées.
+// N.B. Mêmes remarques que concatener et couperA ; les index positionnels des
+// deux listes sont reconstruits si la plage n'est pas à une extrémité.
+Status transfererPlage(Liste *destination, size_t position, Liste *source,
+                       size_t debut, size_t nombre);
+// ------------------------------------------------------------------------------
+
+// Les fonctions suivantes reposent sur la représentation classique (un element
+// par info) et ne sont pas disponibles avec LISTES_DEROULEES.
+#ifndef LISTES_DEROULEES
+
+// ------------------------------------------------------------------------------
+// Crée un réservoir d'éléments découpant des blocs de elementsParBloc éléments
+// (0 pour utiliser la taille par défaut).
+// Le réservoir est restitué lorsque ni l'appelant (cf. libererReservoir) ni
+// aucune liste ne l'utilise plus.
+// Renvoie NULL en cas de mémoire insuffisante
+ReservoirElements *creerReservoir(size_t elementsParBloc);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Abandonne la référence de l'appelant sur reservoir. La mémoire n'est restituée
+// qu'une fois la dernière liste utilisant reservoir détruite.
+void libererReservoir(ReservoirElements *reservoir);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Initialisation d'une liste dont les éléments proviennent de reservoir.
+// Si reservoir vaut NULL, un réservoir privé est créé pour la liste.
+// N.B. Une telle liste doit obligatoirement être restituée avec detruire, qui
+// restitue tous les blocs en une fois, sans parcourir les éléments, si la liste
+// est la dernière utilisatrice du réservoir.
+// Renvoie NULL en cas de mémoire insuffisante
+Liste *initialiserAvecReservoir(ReservoirElements *reservoir);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Caches d'éléments par thread, inactifs par défaut : une fois
+// activerCachesElements appelée, les éléments restitués par une liste sans
+// réservoir sont gardés par le thread qui les restitue, pour ses prochaines
+// insertions, au lieu d'être restitués par free. Chaque thread garde au plus
+// 128 éléments et échange le surplus par lots de 64 avec une réserve commune
+// (d'au plus 256 lots), ce qui évite la contention sur malloc/free lorsque
+// plusieurs threads modifient chacun leurs listes.
+// desactiverCachesElements restitue le cache du thread appelant et la réserve ;
+// le cache de chacun des autres threads n'est restitué qu'à la fin de ce thread.
+// Le cache du thread qui termine le programme et la réserve sont restitués à la
+// sortie du programme.
+// restituerCachesElements restitue le cache du thread appelant et la réserve,
+// sans désactiver les caches.
+void activerCachesElements(void);
+void desactiverCachesElements(void);
+void restituerCachesElements(void);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Dote liste d'un index positionnel, maintenu par toutes les fonctions modifiant
+// liste, qui rend en O(1) la recherche d'un élément par sa position (elementA,
+// vider). L'index occupe un pointeur par élément.
+// Renvoie OK si l'index a pu être créé (ou existait déjà) et MEMOIRE_INSUFFISANTE
+// sinon.
+// N.B. Lorsque l'index doit grandir, une insertion peut renvoyer
+// MEMOIRE_INSUFFISANTE ; la liste n'est alors pas modifiée.
+Status activerIndexPositionnel(Liste *liste);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Supprime, en restituant la mémoire allouée, l'index positionnel de liste.
+void desactiverIndexPositionnel(Liste *liste);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Dote liste d'une empreinte de son contenu (hachage dépendant de l'ordre des
+// infos). Lorsque les deux listes comparées en ont une, sontEgales renvoie false
+// en O(1) si leurs empreintes diffèrent et ne parcourt les listes que pour
+// confirmer l'égalité.
+// L'empreinte est tenue à jour en O(1) par les insertions et suppressions en tête
+// et en queue ; après les autres modifications (supprimerSelonCritere, vider,
+// ...), elle est recalculée lors de la prochaine comparaison.
+// Renvoie OK si l'empreinte a pu être créée (ou existait déjà) et
+// MEMOIRE_INSUFFISANTE sinon.
+Status activerEmpreinte(Liste *liste);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Supprime, en restituant la mémoire allouée, l'empreinte de liste.
+void desactiverEmpreinte(Liste *liste);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Dote liste d'un répertoire de segments : les éléments aux positions 0, pas,
+// 2 * pas... (un pointeur pour pas éléments), qui permet aux traitements
+// parallèles (listes_paralleles.h) de découper liste en segments sans la
+// parcourir. Si pas vaut 0, le répertoire garde un élément sur 1024.
+// Le répertoire est tenu à jour par les insertions et suppressions en queue et
+// par vider ; après les autres modifications, il est reconstruit (en un
+// parcours) lors du prochain traitement parallèle.
+// Renvoie OK si le répertoire a pu être créé (ou existait déjà, son pas étant
+// alors remplacé) et MEMOIRE_INSUFFISANTE sinon.
+Status activerRepertoireSegments(Liste *liste, size_t pas);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Supprime, en restituant la mémoire allouée, le répertoire de segments de liste.
+void desactiverRepertoireSegments(Liste *liste);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Nombre maximal d'infos transmises à la fois au critère de
+// supprimerSelonCritereParLot
+#define TAILLE_LOT_CRITERE 256
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Variante de supprimerSelonCritere dont le critère est évalué par lots : il
+// reçoit nombre (<= TAILLE_LOT_CRITERE) infos consécutives, copiées dans un
+// tableau contigu, la première se trouvant à la position positionDebut, et
+// indique pour chacune d'elles dans aSupprimer[i] si elle doit être supprimée.
+// Un tel critère peut être vectorisé par le compilateur. Les éléments supprimés
+// d'un lot sont restitués en une fois.
+void supprimerSelonCritereParLot(Liste *liste,
+                                 void (*critere)(size_t positionDebut,
+                                                 const Info *infos, size_t nombre,
+                                                 bool *aSupprimer));
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Trie liste de manière stable (des infos égales gardent leur ordre), dans
+// l'ordre croissant défini par comparer, qui renvoie, comme pour qsort, une
+// valeur négative, nulle ou positive si info1 doit être placée avant, peut être
+// placée indifféremment ou doit être placée après info2. Si comparer vaut NULL,
+// les infos sont triées par valeurs croissantes.
+// N.B. Tri par fusion en O(n log n), sans allocation : les infos sont déplacées
+// d'élément en élément (le champ precedent servant de tampon), les éléments
+// restent à leur place ; tete, queue et l'index positionnel restent valables.
+void trier(Liste *liste, int (*comparer)(const Info *info1, const Info *info2));
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Recopie les éléments de liste, dans l'ordre de parcours, dans un bloc contigu
+// neuf puis restitue les anciens, afin que les parcours d'une liste longtemps
+// modifiée en tête et en queue ne sautent plus d'un bout à l'autre du tas.
+// Le contenu et l'ordre des infos sont conservés.
+// Renvoie OK si la liste a été compactée (ou est vide) et MEMOIRE_INSUFFISANTE
+// sinon ; la liste n'est alors pas modifiée.
+// N.B. Une liste sans réservoir ou seule à utiliser le sien reçoit un réservoir
+// privé neuf (l'ancien est restitué en une fois) ; avec un réservoir partagé, le
+// bloc est pris dans celui-ci et les anciens éléments rejoignent ses éléments
+// libres. Les pointeurs sur les éléments (tete, queue, curseurs) ne sont plus
+// valables ; l'index positionnel est reconstruit.
+Status compacter(Liste *liste);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie un curseur sur la tête, resp. la queue, de liste (hors de la liste si
+// celle-ci est vide).
+// N.B. Toute modification de liste faite autrement que par ce curseur rend
+// celui-ci non valable.
+Curseur curseurEnTete(Liste *liste);
+Curseur curseurEnQueue(Liste *liste);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie true si curseur désigne un élément de sa liste, false s'il en est sorti.
+bool estDansListe(const Curseur *curseur);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Déplace curseur sur l'élément suivant, resp. précédent. Au-delà de la queue,
+// resp. de la tête, curseur sort de la liste.
+// Renvoie OK si curseur désigne un élément après le déplacement et
+// POSITION_NON_VALIDE sinon (en particulier s'il était déjà hors de la liste).
+Status avancerCurseur(Curseur *curseur);
+Status reculerCurseur(Curseur *curseur);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie, via le paramètre info, l'info de l'élément désigné par curseur.
+// Renvoie POSITION_NON_VALIDE si curseur est hors de la liste, OK sinon.
+Status infoCurseur(const Curseur *curseur, Info *info);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Insère un nouvel élément (contenant info) juste avant, resp. juste après,
+// l'élément désigné par curseur, qui continue de désigner le même élément.
+// Renvoie OK si l'insertion s'est déroulée avec succès, MEMOIRE_INSUFFISANTE s'il
+// n'y a pas assez de mémoire pour créer le nouvel élément et POSITION_NON_VALIDE
+// si curseur est hors de la liste.
+// N.B. En O(1), sauf si la liste dispose d'un index positionnel : celui-ci est
+// alors décalé depuis l'extrémité la plus proche.
+Status insererAvantCurseur(Curseur *curseur, const Info *info);
+Status insererApresCurseur(Curseur *curseur, const Info *info);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie, via le paramètre info, l'info de l'élément désigné par curseur, puis
+// supprime, en restituant la mémoire allouée, ledit élément. curseur désigne
+// ensuite l'élément suivant (et sort de la liste s'il n'y en a pas).
+// Renvoie POSITION_NON_VALIDE si curseur est hors de la liste, OK sinon.
+// N.B. Même complexité que insererAvantCurseur.
+Status supprimerCurseur(Curseur *curseur, Info *info);
+// ------------------------------------------------------------------------------
+
+#endif
+
 #endif
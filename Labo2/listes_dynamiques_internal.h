@@ -0,0 +1,191 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : listes_dynamiques_internal.h
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : En-tête privé de la librairie de listes doublement chaînées
+                  non circulaires (représentation classique)
+
+ Remarque(s)    : Ce fichier ne doit pas être inclus ailleurs que les fichiers
+                  source de la librairie
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+
+#ifndef LISTES_DYNAMIQUES_INTERNAL_H
+#define LISTES_DYNAMIQUES_INTERNAL_H
+
+#include "listes_dynamiques.h"
+#include <stdint.h>
+
+/**
+ * Bloc contigu d'éléments alloué en une fois par un réservoir
+ */
+typedef struct bloc {
+   struct bloc *suivant;
+   Element elements[];
+} Bloc;
+
+struct reservoir {
+   Bloc *blocs;             // blocs alloués, le plus récent en tête
+   Element *libres;         // éléments restitués, chaînés via suivant
+   size_t elementsParBloc;
+   size_t restantsDansBloc; // éléments pas encore découpés dans blocs
+   size_t references;       // appelant + listes utilisant le réservoir
+};
+
+/**
+ * Tampon circulaire des elements d'une liste dans l'ordre de leurs positions :
+ * l'element à la position p est elements[(debut + p) & (capacite - 1)]. Le
+ * nombre d'elements indexés est celui de la liste (taille).
+ */
+struct indexPositionnel {
+   Element **elements;
+   size_t capacite;         // toujours une puissance de 2
+   size_t debut;
+};
+
+/**
+ * Empreinte du contenu d'une liste : somme, modulo 2^64, des infos mélangées
+ * multipliées par BASE_EMPREINTE^position. Insérer ou retirer une info à une
+ * extremité se répercute en O(1) ; BASE_EMPREINTE étant impaire, elle est
+ * inversible modulo 2^64, ce qui permet de retirer la tete.
+ */
+struct empreinte {
+   uint64_t valeur;
+   uint64_t puissance;      // BASE_EMPREINTE^taille
+   bool valide;             // false : valeur à recalculer avant usage
+};
+
+/**
+ * Répertoire de segments d'une liste : elements[j] est l'element à la position
+ * j * pas. Lorsqu'il est valide, ses nombre entrées couvrent toute la liste
+ * (nombre = taille / pas arrondi vers le haut).
+ */
+struct repertoireSegments {
+   Element **elements;
+   size_t nombre;
+   size_t capacite;
+   size_t pas;
+   bool valide;             // false : à reconstruire avant usage
+};
+
+/**
+ * Marque l'empreinte de liste (si elle existe) comme à recalculer. À appeler par
+ * toute fonction modifiant liste ailleurs qu'à ses extremités.
+ * @param liste
+ */
+void invaliderEmpreinte(Liste *liste);
+
+/**
+ * Recalcule l'empreinte de liste si elle n'est plus valide
+ * @param liste liste ayant une empreinte
+ * @return la valeur de l'empreinte
+ */
+uint64_t valeurEmpreinte(const Liste *liste);
+
+/**
+ * Marque le répertoire de segments de liste (s'il existe) comme à reconstruire.
+ * À appeler par toute fonction modifiant liste ailleurs qu'à sa queue.
+ * @param liste
+ */
+void invaliderRepertoire(Liste *liste);
+
+/**
+ * Reconstruit le répertoire de segments de liste s'il n'est plus valide
+ * @param liste
+ * @return true si liste a un répertoire valide, false si elle n'en a pas ou s'il
+ * n'a pas pu être reconstruit faute de mémoire
+ */
+bool actualiserRepertoire(const Liste *liste);
+
+/**
+ * Alloue un element pour liste (depuis son reservoir s'il en a un). Comme avec
+ * calloc, tous les champs de l'element sont à 0.
+ * @param liste liste qui va contenir l'element
+ * @return l'element alloué ou NULL en cas de mémoire insuffisante
+ */
+Element *allouerElement(Liste *liste);
+
+/**
+ * Restitue la memoire d'un element de liste (à son reservoir s'il en a un)
+ * @param liste liste qui contenait l'element
+ * @param element element à restituer
+ */
+void libererElement(Liste *liste, Element *element);
+
+/**
+ * Alloue un element pour une liste sans reservoir : depuis le cache du thread
+ * appelant s'il en a un, par calloc sinon. Comme avec calloc, tous les champs de
+ * l'element sont à 0.
+ * @return l'element alloué ou NULL en cas de mémoire insuffisante
+ */
+Element *allouerElementSansReservoir(void);
+
+/**
+ * Restitue un element d'une liste sans reservoir : au cache du thread appelant
+ * si les caches sont actifs, par free sinon
+ * @param element element alloué par allouerElementSansReservoir
+ */
+void libererElementSansReservoir(Element *element);
+
+/**
+ * Restitue la memoire de la chaine d'elements debut -> ... -> fin (via suivant),
+ * fin->suivant devant valoir NULL.
+ * Avec un reservoir, la chaine est rendue en une fois à sa liste des libres ;
+ * sinon, elle est confiée à la restitution différée si elle est active, ses
+ * elements sont rendus au cache du thread sinon.
+ * @param liste liste qui contenait les elements
+ * @param debut premier element de la chaine
+ * @param fin dernier element de la chaine
+ */
+void libererChaine(Liste *liste, Element *debut, Element *fin);
+
+/**
+ * Confie la chaine d'elements debut -> ... -> fin (via suivant) à la restitution
+ * différée si elle est active (restitution_differee.h)
+ * @param debut premier element de la chaine
+ * @param fin dernier element de la chaine
+ * @return true si la chaine a été confiée, false si elle doit être restituée
+ * immédiatement
+ */
+bool differerRestitution(Element *debut, Element *fin);
+
+/**
+ * Prend dans reservoir nombre elements contigus, non initialisés. Les elements
+ * sont découpés dans un bloc neuf, jamais repris des elements libres.
+ * @param reservoir
+ * @param nombre nombre d'elements (> 0)
+ * @return le premier des nombre elements ou NULL en cas de mémoire insuffisante
+ */
+Element *allouerElementsContigus(ReservoirElements *reservoir, size_t nombre);
+
+/**
+ * Garantit que l'index positionnel de liste (s'il existe) peut accueillir nombre
+ * elements supplementaires, en doublant sa capacité autant que nécessaire
+ * @param liste
+ * @param nombre nombre d'elements à ajouter
+ * @return OK si l'index a la place nécessaire, MEMOIRE_INSUFFISANTE sinon
+ */
+Status reserverIndex(Liste *liste, size_t nombre);
+
+/**
+ * Remplit l'index positionnel de liste avec ses elements, de la tete à la queue
+ * @param liste liste dont l'index a une capacité suffisante
+ */
+void construireIndex(Liste *liste);
+
+/**
+ *
+ * @param liste liste sur laquelle on veut trouver l'element
+ * @param position position de la liste de l'element souhaité
+ * @param element paramètre d'entrée/sortie pour retourner l'element à position
+ * position. Si NULL est passé en paramètre, ce pointeur n'est pas modifié.
+ * @return OK si on a trouvé l'element. POSITION_NON_VALIDE si la position
+ * position n'est pas valide.
+ */
+Status getElement(const Liste *liste, size_t position, Element **element);
+
+#endif
@@ -0,0 +1,224 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : listes_generiques.h
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Modèle de listes doublement chaînées non circulaires dont les
+                  éléments contiennent directement une valeur d'un type choisi
+                  (double, structure, pointeur...) au lieu d'un Info.
+
+ Remarque(s)    : CREER_LISTE_GENERIQUE génère, pour un type donné, un type de
+                  liste et ses fonctions, toutes static inline. Seuls l'allocation
+                  des elements (calloc/free, comme ceux d'une liste sans
+                  réservoir) et la copie des valeurs sont propres au type : le
+                  chaînage, le parcours positionnel, les suppressions, vider et
+                  la comparaison sont ceux des listes intrusives, chaque element
+                  contenant un Maillon (listes_intrusives.h). Celles-ci étant
+                  static inline, le compilateur les spécialise pour TYPE et
+                  SONT_EGALES : seul le critere de supprimerSelonCritere reste un
+                  appel indirect, comme pour les listes d'Info.
+                  Les fonctions ont la même sémantique que celles du même nom de
+                  listes_dynamiques.h, dont le type Status est repris.
+                  Il n'y a pas d'équivalent d'afficher : le format d'une valeur
+                  dépend de son type (un double, les champs d'une structure...),
+                  que le modèle ignore ; l'appelant parcourt la liste avec
+                  premier/suivant et affiche chaque info à sa façon.
+                  Disponible avec les deux représentations de liste.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+
+#ifndef LISTES_GENERIQUES_H
+#define LISTES_GENERIQUES_H
+
+#include "listes_intrusives.h"
+#include <stdlib.h>
+
+// Comparaison de deux valeurs pointées d'un type scalaire, à passer comme
+// SONT_EGALES à CREER_LISTE_GENERIQUE
+#define VALEURS_EGALES(A, B) (*(A) == *(B))
+
+/**
+ * Macro pour creer un type de liste dont les elements contiennent une valeur de
+ * type TYPE, ainsi que ses fonctions. Pour NOM valant ListeReels, par exemple :
+ * les types ListeReels et ElementListeReels (champs lien et info), les fonctions
+ * initialiserListeReels, estVideListeReels, longueurListeReels,
+ * insererEnTeteListeReels, insererEnQueueListeReels, supprimerEnTeteListeReels,
+ * supprimerEnQueueListeReels, supprimerSelonCritereListeReels,
+ * elementAListeReels, viderListeReels, sontEgalesListeReels,
+ * versTableauListeReels et detruireListeReels, dont les Info sont remplacés par
+ * des TYPE, et les fonctions de parcours premierListeReels, dernierListeReels,
+ * suivantListeReels et precedentListeReels (NULL au-delà des extrémités).
+ * A utiliser une fois par type, hors de toute fonction.
+ * Exemple : CREER_LISTE_GENERIQUE(ListeReels, double, VALEURS_EGALES)
+ * @param NOM nom du type de liste, suffixe du nom des fonctions
+ * @param TYPE type des valeurs contenues dans les elements
+ * @param SONT_EGALES fonction ou macro recevant deux TYPE const * et vraie si les
+ * valeurs pointées sont égales (VALEURS_EGALES pour un type scalaire)
+ */
+#define CREER_LISTE_GENERIQUE(NOM, TYPE, SONT_EGALES)                              \
+typedef struct {                                                                   \
+   Maillon lien;                                                                   \
+   TYPE info;                                                                      \
+} Element##NOM;                                                                    \
+                                                                                   \
+typedef struct {                                                                   \
+   ListeIntrusive liens;                                                           \
+} NOM;                                                                             \
+                                                                                   \
+static inline Element##NOM *element##NOM(const Maillon *maillon) {                 \
+   return maillon ? CONTENEUR(maillon, Element##NOM, lien) : NULL;                 \
+}                                                                                  \
+                                                                                   \
+static inline void restituer##NOM(Maillon *maillon) {                              \
+   free(element##NOM(maillon));                                                    \
+}                                                                                  \
+                                                                                   \
+static inline bool maillonsEgaux##NOM(const Maillon *maillon1,                     \
+                                      const Maillon *maillon2) {                   \
+   return SONT_EGALES(&element##NOM(maillon1)->info,                               \
+                      &element##NOM(maillon2)->info);                              \
+}                                                                                  \
+                                                                                   \
+static inline Element##NOM *nouvelElement##NOM(TYPE const *info) {                 \
+   /* calloc : info à 0 si NULL est passé */                                       \
+   Element##NOM *element = (Element##NOM *) calloc(1, sizeof(Element##NOM));       \
+   if (element && info) {                                                          \
+      element->info = *info;                                                       \
+   }                                                                               \
+   return element;                                                                 \
+}                                                                                  \
+                                                                                   \
+static inline NOM *initialiser##NOM(void) {                                        \
+   NOM *liste = (NOM *) malloc(sizeof(NOM));                                       \
+   if (liste) {                                                                    \
+      initialiserIntrusive(&liste->liens);                                         \
+   }                                                                               \
+   return liste;                                                                   \
+}                                                                                  \
+                                                                                   \
+static inline bool estVide##NOM(const NOM *liste) {                                \
+   return estVideIntrusive(&liste->liens);                                         \
+}                                                                                  \
+                                                                                   \
+static inline size_t longueur##NOM(const NOM *liste) {                             \
+   return longueurIntrusive(&liste->liens);                                        \
+}                                                                                  \
+                                                                                   \
+static inline Element##NOM *premier##NOM(const NOM *liste) {                       \
+   return element##NOM(liste->liens.tete);                                         \
+}                                                                                  \
+                                                                                   \
+static inline Element##NOM *dernier##NOM(const NOM *liste) {                       \
+   return element##NOM(liste->liens.queue);                                        \
+}                                                                                  \
+                                                                                   \
+static inline Element##NOM *suivant##NOM(const Element##NOM *element) {            \
+   return element##NOM(element->lien.suivant);                                     \
+}                                                                                  \
+                                                                                   \
+static inline Element##NOM *precedent##NOM(const Element##NOM *element) {          \
+   return element##NOM(element->lien.precedent);                                   \
+}                                                                                  \
+                                                                                   \
+static inline Status insererEnTete##NOM(NOM *liste, TYPE const *info) {            \
+   Element##NOM *element = nouvelElement##NOM(info);                               \
+   if (!element) {                                                                 \
+      return MEMOIRE_INSUFFISANTE;                                                 \
+   }                                                                               \
+   insererEnTeteIntrusive(&liste->liens, &element->lien);                          \
+   return OK;                                                                      \
+}                                                                                  \
+                                                                                   \
+static inline Status insererEnQueue##NOM(NOM *liste, TYPE const *info) {           \
+   Element##NOM *element = nouvelElement##NOM(info);                               \
+   if (!element) {                                                                 \
+      return MEMOIRE_INSUFFISANTE;                                                 \
+   }                                                                               \
+   insererEnQueueIntrusive(&liste->liens, &element->lien);                         \
+   return OK;                                                                      \
+}                                                                                  \
+                                                                                   \
+static inline Status supprimerEnTete##NOM(NOM *liste, TYPE *info) {                \
+   Maillon *maillon;                                                               \
+   if (supprimerEnTeteIntrusive(&liste->liens, &maillon) != OK) {                  \
+      return LISTE_VIDE;                                                           \
+   }                                                                               \
+   if (info) {                                                                     \
+      *info = element##NOM(maillon)->info;                                         \
+   }                                                                               \
+   restituer##NOM(maillon);                                                        \
+   return OK;                                                                      \
+}                                                                                  \
+                                                                                   \
+static inline Status supprimerEnQueue##NOM(NOM *liste, TYPE *info) {               \
+   Maillon *maillon;                                                               \
+   if (supprimerEnQueueIntrusive(&liste->liens, &maillon) != OK) {                 \
+      return LISTE_VIDE;                                                           \
+   }                                                                               \
+   if (info) {                                                                     \
+      *info = element##NOM(maillon)->info;                                         \
+   }                                                                               \
+   restituer##NOM(maillon);                                                        \
+   return OK;                                                                      \
+}                                                                                  \
+                                                                                   \
+static inline void supprimerSelonCritere##NOM(NOM *liste,                          \
+                                              bool (*critere)(size_t position,     \
+                                                              TYPE const *info)) { \
+   if (!critere) {                                                                 \
+      return;                                                                      \
+   }                                                                               \
+   size_t position = 0;                                                            \
+   Maillon *maillon = liste->liens.tete;                                           \
+   while (maillon) {                                                               \
+      Maillon *suivant = maillon->suivant;                                         \
+      if (critere(position++, &element##NOM(maillon)->info)) {                     \
+         retirerIntrusive(&liste->liens, maillon);                                 \
+         restituer##NOM(maillon);                                                  \
+      }                                                                            \
+      maillon = suivant;                                                           \
+   }                                                                               \
+}                                                                                  \
+                                                                                   \
+static inline Status elementA##NOM(const NOM *liste, size_t position,              \
+                                   TYPE *info) {                                   \
+   Maillon *maillon = maillonAIntrusive(&liste->liens, position);                  \
+   if (!maillon) {                                                                 \
+      return POSITION_NON_VALIDE;                                                  \
+   }                                                                               \
+   if (info) {                                                                     \
+      *info = element##NOM(maillon)->info;                                         \
+   }                                                                               \
+   return OK;                                                                      \
+}                                                                                  \
+                                                                                   \
+static inline void vider##NOM(NOM *liste, size_t position) {                       \
+   viderIntrusive(&liste->liens, position, restituer##NOM);                        \
+}                                                                                  \
+                                                                                   \
+static inline bool sontEgales##NOM(const NOM *liste1, const NOM *liste2) {         \
+   return sontEgalesIntrusives(&liste1->liens, &liste2->liens,                     \
+                               maillonsEgaux##NOM);                                \
+}                                                                                  \
+                                                                                   \
+static inline size_t versTableau##NOM(const NOM *liste, TYPE *tableau,             \
+                                      size_t capacite) {                           \
+   size_t nombre = 0;                                                              \
+   for (const Maillon *maillon = liste->liens.tete; maillon && nombre < capacite;  \
+        maillon = maillon->suivant) {                                              \
+      tableau[nombre++] = element##NOM(maillon)->info;                             \
+   }                                                                               \
+   return nombre;                                                                  \
+}                                                                                  \
+                                                                                   \
+static inline void detruire##NOM(NOM *liste) {                                     \
+   if (liste) {                                                                    \
+      vider##NOM(liste, 0);                                                        \
+      free(liste);                                                                 \
+   }                                                                               \
+}
+
+#endif
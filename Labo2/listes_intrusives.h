@@ -0,0 +1,270 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : listes_intrusives.h
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Listes intrusives doublement chaînées non circulaires : les
+                  liens (Maillon) sont des champs des structures de l'appelant et
+                  la liste ne fait que les chaîner.
+
+ Remarque(s)    : Aucune fonction n'alloue ni ne restitue de mémoire : les
+                  structures chaînées appartiennent à l'appelant, qui doit les
+                  garder en vie tant qu'elles sont dans une liste. Un maillon ne
+                  peut appartenir qu'à une liste à la fois ; un maillon retiré a
+                  ses liens remis à NULL.
+                  Toutes les fonctions sont static inline : le compilateur peut
+                  les spécialiser pour les fonctions passées en paramètre
+                  (retire, sontEgaux...) quand celles-ci sont connues à la
+                  compilation, comme dans listes_generiques.h.
+                  Aucune vérification sur le pointeur 'liste' passé en paramètre
+                  aux fonctions n'est effectuée.
+                  Disponible avec les deux représentations de liste.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+
+#ifndef LISTES_INTRUSIVES_H
+#define LISTES_INTRUSIVES_H
+
+#include "listes_dynamiques.h"
+
+// Liens à placer dans la structure de l'appelant
+typedef struct maillon {
+   struct maillon *suivant;
+   struct maillon *precedent;
+} Maillon;
+
+typedef struct {
+   Maillon *tete;
+   Maillon *queue;
+   size_t taille;                // nombre de maillons de la liste
+} ListeIntrusive;
+
+// Renvoie l'adresse de la structure de type TYPE dont le champ CHAMP est le
+// maillon pointé par MAILLON.
+// Exemple : Enregistrement *e = CONTENEUR(maillon, Enregistrement, lien);
+#define CONTENEUR(MAILLON, TYPE, CHAMP) \
+   ((TYPE *) (void *) ((char *) (MAILLON) - offsetof(TYPE, CHAMP)))
+
+// ------------------------------------------------------------------------------
+// Initialisation de liste (fournie par l'appelant) à une liste vide.
+static inline void initialiserIntrusive(ListeIntrusive *liste) {
+   liste->tete = NULL;
+   liste->queue = NULL;
+   liste->taille = 0;
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie true si liste est vide, false sinon.
+static inline bool estVideIntrusive(const ListeIntrusive *liste) {
+   return liste->tete == NULL;
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie combien il y a de maillons dans liste, en O(1).
+static inline size_t longueurIntrusive(const ListeIntrusive *liste) {
+   return liste->taille;
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Chaîne maillon en tête de liste.
+static inline void insererEnTeteIntrusive(ListeIntrusive *liste, Maillon *maillon) {
+   maillon->precedent = NULL;
+   maillon->suivant = liste->tete;
+   if (liste->tete) {
+      liste->tete->precedent = maillon;
+   } else {
+      liste->queue = maillon;
+   }
+   liste->tete = maillon;
+   liste->taille++;
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Chaîne maillon en queue de liste.
+static inline void insererEnQueueIntrusive(ListeIntrusive *liste, Maillon *maillon) {
+   maillon->suivant = NULL;
+   maillon->precedent = liste->queue;
+   if (liste->queue) {
+      liste->queue->suivant = maillon;
+   } else {
+      liste->tete = maillon;
+   }
+   liste->queue = maillon;
+   liste->taille++;
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Détache de liste maillon, qui doit en faire partie, en O(1).
+static inline void retirerIntrusive(ListeIntrusive *liste, Maillon *maillon) {
+   if (maillon->precedent) {
+      maillon->precedent->suivant = maillon->suivant;
+   } else {
+      liste->tete = maillon->suivant;
+   }
+   if (maillon->suivant) {
+      maillon->suivant->precedent = maillon->precedent;
+   } else {
+      liste->queue = maillon->precedent;
+   }
+   liste->taille--;
+   maillon->suivant = NULL;
+   maillon->precedent = NULL;
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie, via le paramètre maillon, le maillon en tête de liste et le retire de
+// liste.
+// Renvoie LISTE_VIDE si la liste passée en paramètre est vide, OK sinon.
+static inline Status supprimerEnTeteIntrusive(ListeIntrusive *liste,
+                                              Maillon **maillon) {
+   if (estVideIntrusive(liste)) {
+      return LISTE_VIDE;
+   }
+   Maillon *tete = liste->tete;
+   retirerIntrusive(liste, tete);
+   if (maillon) {
+      *maillon = tete;
+   }
+   return OK;
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie, via le paramètre maillon, le maillon en queue de liste et le retire de
+// liste.
+// Renvoie LISTE_VIDE si la liste passée en paramètre est vide, OK sinon.
+static inline Status supprimerEnQueueIntrusive(ListeIntrusive *liste,
+                                               Maillon **maillon) {
+   if (estVideIntrusive(liste)) {
+      return LISTE_VIDE;
+   }
+   Maillon *queue = liste->queue;
+   retirerIntrusive(liste, queue);
+   if (maillon) {
+      *maillon = queue;
+   }
+   return OK;
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie le maillon à la position position de liste, ou NULL si position n'est
+// pas valide. Le parcours part de l'extrémité la plus proche de position.
+static inline Maillon *maillonAIntrusive(const ListeIntrusive *liste,
+                                         size_t position) {
+   if (position >= liste->taille) {
+      return NULL;
+   }
+   Maillon *maillonActuel;
+   if (position < liste->taille / 2) {
+      maillonActuel = liste->tete;
+      for (size_t i = 0; i < position; i++) {
+         maillonActuel = maillonActuel->suivant;
+      }
+   } else {
+      // la position est plus proche de la queue : on remonte depuis celle-ci
+      maillonActuel = liste->queue;
+      for (size_t i = liste->taille - 1; i > position; i--) {
+         maillonActuel = maillonActuel->precedent;
+      }
+   }
+   return maillonActuel;
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Retire de liste tous les maillons qui vérifient critere. Si retire ne vaut pas
+// NULL, il est appelé pour chaque maillon retiré (par exemple pour le restituer),
+// après que celui-ci a été détaché de liste.
+static inline void supprimerSelonCritereIntrusive(ListeIntrusive *liste,
+                                                  bool (*critere)(size_t position,
+                                                                  const Maillon *maillon),
+                                                  void (*retire)(Maillon *maillon)) {
+   // verifier les parametres d'entree
+   if (!critere) {
+      return;
+   }
+   Maillon *maillonActuel = liste->tete;
+   size_t position = 0;
+   while (maillonActuel) {
+      Maillon *suivant = maillonActuel->suivant;
+      if (critere(position, maillonActuel)) {
+         retirerIntrusive(liste, maillonActuel);
+         // le maillon est détaché : retire peut le réutiliser ou le restituer
+         if (retire) {
+            retire(maillonActuel);
+         }
+      }
+      maillonActuel = suivant;
+      position++;
+   }
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Retire de liste tous les maillons à partir de la position position, en appelant
+// retire (s'il ne vaut pas NULL) pour chacun d'eux.
+// N.B. Vider à partir de la position 0 signifie vider toute la liste. Le
+// parcours part de l'extrémité la plus proche de position.
+static inline void viderIntrusive(ListeIntrusive *liste, size_t position,
+                                  void (*retire)(Maillon *maillon)) {
+   Maillon *maillonActuel = maillonAIntrusive(liste, position);
+   if (!maillonActuel) {
+      return;
+   }
+   liste->queue = maillonActuel->precedent;
+   if (liste->queue) {
+      liste->queue->suivant = NULL;
+   } else {
+      liste->tete = NULL;
+   }
+   liste->taille = position;
+
+   // liste à jour : on détache les maillons retirés un à un
+   while (maillonActuel) {
+      Maillon *suivant = maillonActuel->suivant;
+      maillonActuel->suivant = NULL;
+      maillonActuel->precedent = NULL;
+      if (retire) {
+         retire(maillonActuel);
+      }
+      maillonActuel = suivant;
+   }
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie true si liste1 et liste2 ont la même longueur et si sontEgaux renvoie
+// true pour chaque paire de maillons de même position, false sinon.
+// N.B. 2 listes vides sont considérées comme égales.
+static inline bool sontEgalesIntrusives(const ListeIntrusive *liste1,
+                                        const ListeIntrusive *liste2,
+                                        bool (*sontEgaux)(const Maillon *maillon1,
+                                                          const Maillon *maillon2)) {
+   // des listes de longueurs différentes ne peuvent pas être égales
+   if (liste1->taille != liste2->taille) {
+      return false;
+   }
+   const Maillon *maillonL1 = liste1->tete;
+   const Maillon *maillonL2 = liste2->tete;
+   while (maillonL1 && maillonL2) {
+      if (!sontEgaux(maillonL1, maillonL2)) {
+         return false;
+      }
+      maillonL1 = maillonL1->suivant;
+      maillonL2 = maillonL2->suivant;
+   }
+   return maillonL1 == NULL && maillonL2 == NULL;
+}
+// ------------------------------------------------------------------------------
+
+#endif
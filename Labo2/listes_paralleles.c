@@ -0,0 +1,640 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : listes_paralleles.c
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Ce fichier implémente les traitements parallèles sur les
+                  listes doublement chaînées non circulaires.
+
+ Remarque(s)    : Chaque thread ne modifie que les elements de son segment ; les
+                  liens entre segments sont refaits par le thread appelant une
+                  fois tous les threads terminés.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+#include "listes_paralleles.h"
+#include "listes_dynamiques_internal.h"
+#include "instrumentation_internal.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Nombre maximal de threads utilisés par un traitement
+#define THREADS_MAX 64
+
+// Nombre d'elements comparés par sontEgalesParallele entre deux consultations
+// du résultat des autres threads
+#define ELEMENTS_ENTRE_CONSULTATIONS 4096
+
+/**
+ * Travail confié à un thread par supprimerSelonCritereParallele
+ */
+typedef struct {
+   // entrées
+   Liste *liste;
+   bool (*critere)(size_t position, const Info *info);
+   Element *debut;           // premier element du segment
+   size_t nombre;            // nombre d'elements du segment
+   size_t position;          // position de debut dans la liste
+   size_t positionIndex;     // position du premier conservé (phase d'indexation)
+   // sorties
+   Element *premierConserve;
+   Element *dernierConserve;
+   size_t conserves;
+   Element *debutSupprimes;  // elements à rendre au reservoir (chaînés via
+   Element *finSupprimes;    // suivant), NULL si déjà restitués par le thread
+} SegmentCritere;
+
+/**
+ * Travail confié à un thread par insererTableauEnQueueParallele
+ */
+typedef struct {
+   // entrées
+   const Liste *liste;
+   const Info *tableau;      // infos de la tranche (NULL : infos à 0)
+   Element *elements;        // elements contigus de la tranche (NULL : à allouer)
+   size_t nombre;            // nombre d'elements de la tranche
+   size_t positionIndex;     // position du premier element dans la liste
+   // sorties
+   Element *debut;           // NULL en cas de mémoire insuffisante
+   Element *fin;
+} TrancheConstruction;
+
+/**
+ * Travail confié à un thread par compterSelonCritereParallele
+ */
+typedef struct {
+   // entrées
+   bool (*critere)(size_t position, const Info *info);
+   const Element *debut;     // premier element du segment
+   size_t nombre;            // nombre d'elements du segment
+   size_t position;          // position de debut dans la liste
+   // sorties
+   size_t compte;
+} SegmentComptage;
+
+/**
+ * Travail confié à un thread par sontEgalesParallele
+ */
+typedef struct {
+   // entrées
+   const Element *debut1;    // premiers elements des segments de même position
+   const Element *debut2;
+   size_t nombre;            // nombre d'elements des segments
+   atomic_bool *differentes; // partagé : une différence a été trouvée
+   // sorties
+   size_t compares;
+} SegmentComparaison;
+
+/**
+ * Travail confié à un thread par replierParallele
+ */
+typedef struct {
+   // entrées
+   void (*accumuler)(void *partiel, size_t position, const Info *info);
+   const Element *debut;     // premier element du segment
+   size_t nombre;            // nombre d'elements du segment
+   size_t position;          // position de debut dans la liste
+   // entrée-sortie
+   void *partiel;            // résultat partiel du segment
+} SegmentRepliage;
+
+/**
+ * Exécute tache sur chacun des nombre travaux du tableau travaux (de taille
+ * tailleTravail octets chacun), chacun dans son propre thread, le premier dans
+ * le thread appelant. Si un thread ne peut pas être créé, son travail est
+ * effectué par le thread appelant.
+ * @param tache fonction à exécuter
+ * @param travaux tableau des travaux
+ * @param tailleTravail taille d'un travail en octets
+ * @param nombre nombre de travaux (<= THREADS_MAX)
+ */
+static void executerEnParallele(void *(*tache)(void *), void *travaux,
+                                size_t tailleTravail, size_t nombre);
+
+/**
+ * Détermine le nombre de segments à utiliser pour traiter taille elements
+ * @param taille nombre d'elements à traiter
+ * @param nombreThreads nombre de threads demandé
+ * @return nombre de segments, 1 si le traitement doit être séquentiel
+ */
+static size_t nombreSegments(size_t taille, size_t nombreThreads);
+
+/**
+ * Découpe liste en nombre segments consécutifs de tailles égales (à un element
+ * près) et renvoie via debuts le premier element de chaque segment. Le
+ * découpage utilise l'index positionnel ou, à défaut, le répertoire de segments
+ * de liste ; il nécessite sinon un parcours.
+ * @param liste liste non vide
+ * @param nombre nombre de segments (<= longueur(liste))
+ * @param debuts tableau d'au moins nombre elements
+ */
+static void decouper(const Liste *liste, size_t nombre, Element **debuts);
+
+/**
+ * Évalue le critere sur un segment et y supprime les elements qui le vérifient.
+ * Sans reservoir, le thread restitue lui-même les elements supprimés ; avec un
+ * reservoir, ils sont laissés chaînés pour le thread appelant
+ * @param argument SegmentCritere à traiter
+ * @return NULL
+ */
+static void *filtrerSegment(void *argument);
+
+/**
+ * Initialise (en les allouant un à un si nécessaire) et chaîne les elements
+ * d'une tranche, puis les range dans l'index positionnel
+ * @param argument TrancheConstruction à traiter
+ * @return NULL
+ */
+static void *construireTranche(void *argument);
+
+/**
+ * Remplit l'index positionnel avec les elements conservés d'un segment
+ * @param argument SegmentCritere déjà filtré
+ * @return NULL
+ */
+static void *indexerSegment(void *argument);
+
+/**
+ * Compte les elements d'un segment qui vérifient le critere
+ * @param argument SegmentComptage à traiter
+ * @return NULL
+ */
+static void *compterSegment(void *argument);
+
+/**
+ * Compare les infos de deux segments de même position, jusqu'à la première
+ * différence, trouvée par ce thread ou par un autre
+ * @param argument SegmentComparaison à traiter
+ * @return NULL
+ */
+static void *comparerSegments(void *argument);
+
+/**
+ * Accumule les infos d'un segment dans son résultat partiel
+ * @param argument SegmentRepliage à traiter
+ * @return NULL
+ */
+static void *replierSegment(void *argument);
+
+void executerEnParallele(void *(*tache)(void *), void *travaux,
+                         size_t tailleTravail, size_t nombre) {
+   pthread_t threads[THREADS_MAX];
+   bool cree[THREADS_MAX] = {false};
+   unsigned char *travail = (unsigned char *) travaux;
+
+   for (size_t i = 1; i < nombre; i++) {
+      cree[i] = pthread_create(&threads[i], NULL, tache,
+                               travail + i * tailleTravail) == 0;
+   }
+   tache(travail);
+   for (size_t i = 1; i < nombre; i++) {
+      if (cree[i]) {
+         pthread_join(threads[i], NULL);
+      } else {
+         tache(travail + i * tailleTravail);
+      }
+   }
+}
+
+size_t nombreSegments(size_t taille, size_t nombreThreads) {
+   size_t nombre = nombreThreads < THREADS_MAX ? nombreThreads : THREADS_MAX;
+   if (taille / ELEMENTS_MIN_PAR_THREAD < nombre) {
+      nombre = taille / ELEMENTS_MIN_PAR_THREAD;
+   }
+   return nombre ? nombre : 1;
+}
+
+void decouper(const Liste *liste, size_t nombre, Element **debuts) {
+   // un traitement séquentiel ne justifie pas de reconstruire le répertoire
+   if (nombre == 1) {
+      debuts[0] = liste->tete;
+      return;
+   }
+   if (liste->index) {
+      for (size_t i = 0; i < nombre; i++) {
+         getElement(liste, i * liste->taille / nombre, &debuts[i]);
+      }
+      return;
+   }
+   if (actualiserRepertoire(liste)) {
+      // chaque debut est à moins de pas elements de l'entrée qui le précède
+      const RepertoireSegments *repertoire = liste->repertoire;
+      for (size_t i = 0; i < nombre; i++) {
+         size_t debut = i * liste->taille / nombre;
+         Element *element = repertoire->elements[debut / repertoire->pas];
+         for (size_t ecart = debut % repertoire->pas; ecart; ecart--) {
+            element = element->suivant;
+         }
+         debuts[i] = element;
+      }
+      return;
+   }
+
+   // sans index, un seul parcours pour trouver tous les debuts de segments
+   Element *element = liste->tete;
+   size_t position = 0;
+   for (size_t i = 0; i < nombre; i++) {
+      for (size_t debut = i * liste->taille / nombre; position < debut; position++) {
+         element = element->suivant;
+      }
+      debuts[i] = element;
+   }
+}
+
+void *filtrerSegment(void *argument) {
+   SegmentCritere *segment = (SegmentCritere *) argument;
+   Element *element = segment->debut;
+   Element *dernierConserve = NULL;
+
+   for (size_t i = 0; i < segment->nombre; i++) {
+      // suivant n'est déréférencé que s'il appartient au segment
+      Element *suivant = element->suivant;
+      if (segment->critere(segment->position + i, &element->info)) {
+         if (segment->finSupprimes) {
+            segment->finSupprimes->suivant = element;
+         } else {
+            segment->debutSupprimes = element;
+         }
+         segment->finSupprimes = element;
+      } else {
+         // le precedent du premier conservé (hors segment) est refait au
+         // raccordement
+         if (element->precedent != dernierConserve) {
+            element->precedent = dernierConserve;
+            if (dernierConserve) {
+               dernierConserve->suivant = element;
+            }
+         }
+         if (!dernierConserve) {
+            segment->premierConserve = element;
+         }
+         dernierConserve = element;
+         segment->conserves++;
+      }
+      element = suivant;
+   }
+   segment->dernierConserve = dernierConserve;
+
+   // restitution différée, free et caches d'elements acceptent des elements de
+   // plusieurs threads à la fois ; un reservoir (éventuellement partagé) non :
+   // le thread appelant y accroche les chaînes, en O(1) chacune
+   if (segment->debutSupprimes && !segment->liste->reservoir) {
+      segment->finSupprimes->suivant = NULL;
+      libererChaine(segment->liste, segment->debutSupprimes, segment->finSupprimes);
+      segment->debutSupprimes = NULL;
+   }
+   return NULL;
+}
+
+void *indexerSegment(void *argument) {
+   SegmentCritere *segment = (SegmentCritere *) argument;
+   const IndexPositionnel *index = segment->liste->index;
+   Element *element = segment->premierConserve;
+
+   for (size_t i = 0; i < segment->conserves; i++) {
+      index->elements[(index->debut + segment->positionIndex + i) &
+                      (index->capacite - 1)] = element;
+      element = element->suivant;
+   }
+   return NULL;
+}
+
+void supprimerSelonCritereParallele(Liste *liste,
+                                    bool (*critere)(size_t position,
+                                                    const Info *info),
+                                    size_t nombreThreads) {
+   INSTRUMENTER(SUPPRIMER_SELON_CRITERE_PARALLELE);
+   // verifier les parametres d'entree
+   if (!critere || estVide(liste)) {
+      return;
+   }
+   size_t nombre = nombreSegments(liste->taille, nombreThreads);
+   if (nombre == 1) {
+      supprimerSelonCritere(liste, critere);
+      return;
+   }
+
+   Element *debuts[THREADS_MAX];
+   SegmentCritere segments[THREADS_MAX] = {{0}};
+   decouper(liste, nombre, debuts);
+   for (size_t i = 0; i < nombre; i++) {
+      segments[i].liste = liste;
+      segments[i].critere = critere;
+      segments[i].debut = debuts[i];
+      segments[i].position = i * liste->taille / nombre;
+      segments[i].nombre = (i + 1) * liste->taille / nombre - segments[i].position;
+   }
+
+   executerEnParallele(filtrerSegment, segments, sizeof(SegmentCritere), nombre);
+   // les segments sont parcourus par les threads : ils sont comptés ici
+   COMPTER_PARCOURUS(liste->taille);
+
+   // raccorder les segments conservés et rendre au reservoir les elements
+   // supprimés
+   Element *dernierConserve = NULL;
+   size_t conserves = 0;
+   liste->tete = NULL;
+   for (size_t i = 0; i < nombre; i++) {
+      SegmentCritere *segment = &segments[i];
+      if (segment->conserves) {
+         segment->premierConserve->precedent = dernierConserve;
+         if (dernierConserve) {
+            dernierConserve->suivant = segment->premierConserve;
+         } else {
+            liste->tete = segment->premierConserve;
+         }
+         dernierConserve = segment->dernierConserve;
+      }
+      segment->positionIndex = conserves;
+      conserves += segment->conserves;
+
+      COMPTER_RESTITUTIONS(segment->nombre - segment->conserves, 0);
+      if (segment->debutSupprimes) {
+         segment->finSupprimes->suivant = NULL;
+         libererChaine(liste, segment->debutSupprimes, segment->finSupprimes);
+      }
+   }
+   if (dernierConserve) {
+      dernierConserve->suivant = NULL;
+   }
+   liste->queue = dernierConserve;
+   if (conserves != liste->taille) {
+      invaliderEmpreinte(liste);
+      invaliderRepertoire(liste);
+   }
+   liste->taille = conserves;
+
+   if (liste->index) {
+      executerEnParallele(indexerSegment, segments, sizeof(SegmentCritere), nombre);
+   }
+}
+
+void *construireTranche(void *argument) {
+   TrancheConstruction *tranche = (TrancheConstruction *) argument;
+   Element *precedent = NULL;
+   for (size_t i = 0; i < tranche->nombre; i++) {
+      Element *element;
+      if (tranche->elements) {
+         element = &tranche->elements[i];
+      } else if (!(element = allouerElementSansReservoir())) {
+         // on rend les elements deja alloués de la tranche
+         while (precedent) {
+            Element *tmp = precedent;
+            precedent = precedent->precedent;
+            libererElementSansReservoir(tmp);
+         }
+         COMPTER_RESTITUTIONS(i, 0);
+         tranche->debut = NULL;
+         return NULL;
+      }
+      element->info = tranche->tableau ? tranche->tableau[i] : 0;
+      element->precedent = precedent;
+      element->suivant = NULL;
+      if (precedent) {
+         precedent->suivant = element;
+      } else {
+         tranche->debut = element;
+      }
+      precedent = element;
+   }
+   tranche->fin = precedent;
+
+   const IndexPositionnel *index = tranche->liste->index;
+   if (index) {
+      size_t position = index->debut + tranche->positionIndex;
+      for (Element *element = tranche->debut; element; element = element->suivant) {
+         index->elements[position++ & (index->capacite - 1)] = element;
+      }
+   }
+   return NULL;
+}
+
+Status insererTableauEnQueueParallele(Liste *liste, const Info *tableau,
+                                      size_t nombre, size_t nombreThreads) {
+   INSTRUMENTER(INSERER_TABLEAU_EN_QUEUE_PARALLELE);
+   size_t nombreTranches = nombreSegments(nombre, nombreThreads);
+   if (nombreTranches == 1) {
+      return insererTableauEnQueue(liste, tableau, nombre);
+   }
+   if (reserverIndex(liste, nombre) != OK) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+
+   // comme insererTableauEnQueue : une liste vide peut passer à un reservoir
+   // privé, dont les elements sont pris d'un seul bloc par le thread appelant
+   bool reservoirCree = false;
+   if (!liste->reservoir && estVide(liste)) {
+      if (!(liste->reservoir = creerReservoir(0))) {
+         return MEMOIRE_INSUFFISANTE;
+      }
+      reservoirCree = true;
+   }
+   Element *elements = NULL;
+   if (liste->reservoir) {
+      if (!(elements = allouerElementsContigus(liste->reservoir, nombre))) {
+         if (reservoirCree) {
+            libererReservoir(liste->reservoir);
+            liste->reservoir = NULL;
+         }
+         return MEMOIRE_INSUFFISANTE;
+      }
+      COMPTER_ALLOCATIONS(nombre, 0);
+   }
+
+   TrancheConstruction tranches[THREADS_MAX] = {{0}};
+   for (size_t i = 0; i < nombreTranches; i++) {
+      size_t position = i * nombre / nombreTranches;
+      tranches[i].liste = liste;
+      tranches[i].tableau = tableau ? tableau + position : NULL;
+      tranches[i].elements = elements ? elements + position : NULL;
+      tranches[i].nombre = (i + 1) * nombre / nombreTranches - position;
+      tranches[i].positionIndex = liste->taille + position;
+   }
+   executerEnParallele(construireTranche, tranches, sizeof(TrancheConstruction),
+                       nombreTranches);
+
+   bool complet = true;
+   for (size_t i = 0; i < nombreTranches; i++) {
+      complet = complet && tranches[i].debut;
+   }
+   if (!complet) {
+      // seules les tranches allouées un à un peuvent échouer
+      for (size_t i = 0; i < nombreTranches; i++) {
+         if (tranches[i].debut) {
+            COMPTER_RESTITUTIONS(tranches[i].nombre, 0);
+            libererChaine(liste, tranches[i].debut, tranches[i].fin);
+         }
+      }
+      return MEMOIRE_INSUFFISANTE;
+   }
+
+   // raccorder les tranches entre elles puis à la queue de la liste
+   for (size_t i = 1; i < nombreTranches; i++) {
+      tranches[i - 1].fin->suivant = tranches[i].debut;
+      tranches[i].debut->precedent = tranches[i - 1].fin;
+   }
+   tranches[0].debut->precedent = liste->queue;
+   if (liste->queue) {
+      liste->queue->suivant = tranches[0].debut;
+   } else {
+      liste->tete = tranches[0].debut;
+   }
+   liste->queue = tranches[nombreTranches - 1].fin;
+   liste->taille += nombre;
+   invaliderEmpreinte(liste);
+   invaliderRepertoire(liste);
+   return OK;
+}
+
+void *compterSegment(void *argument) {
+   SegmentComptage *segment = (SegmentComptage *) argument;
+   const Element *element = segment->debut;
+   for (size_t i = 0; i < segment->nombre; i++) {
+      segment->compte += segment->critere(segment->position + i, &element->info);
+      element = element->suivant;
+   }
+   return NULL;
+}
+
+size_t compterSelonCritereParallele(const Liste *liste,
+                                    bool (*critere)(size_t position,
+                                                    const Info *info),
+                                    size_t nombreThreads) {
+   INSTRUMENTER(COMPTER_SELON_CRITERE_PARALLELE);
+   if (!critere || estVide(liste)) {
+      return 0;
+   }
+   size_t nombre = nombreSegments(liste->taille, nombreThreads);
+   Element *debuts[THREADS_MAX];
+   SegmentComptage segments[THREADS_MAX] = {{0}};
+   decouper(liste, nombre, debuts);
+   for (size_t i = 0; i < nombre; i++) {
+      segments[i].critere = critere;
+      segments[i].debut = debuts[i];
+      segments[i].position = i * liste->taille / nombre;
+      segments[i].nombre = (i + 1) * liste->taille / nombre - segments[i].position;
+   }
+
+   executerEnParallele(compterSegment, segments, sizeof(SegmentComptage), nombre);
+   COMPTER_PARCOURUS(liste->taille);
+   size_t compte = 0;
+   for (size_t i = 0; i < nombre; i++) {
+      compte += segments[i].compte;
+   }
+   return compte;
+}
+
+void *comparerSegments(void *argument) {
+   SegmentComparaison *segment = (SegmentComparaison *) argument;
+   const Element *element1 = segment->debut1;
+   const Element *element2 = segment->debut2;
+   for (size_t i = 0; i < segment->nombre; i++) {
+      if (i % ELEMENTS_ENTRE_CONSULTATIONS == 0 &&
+          atomic_load_explicit(segment->differentes, memory_order_relaxed)) {
+         break;
+      }
+      segment->compares++;
+      if (element1->info != element2->info) {
+         atomic_store_explicit(segment->differentes, true, memory_order_relaxed);
+         break;
+      }
+      element1 = element1->suivant;
+      element2 = element2->suivant;
+   }
+   return NULL;
+}
+
+bool sontEgalesParallele(const Liste *liste1, const Liste *liste2,
+                         size_t nombreThreads) {
+   INSTRUMENTER(SONT_EGALES_PARALLELE);
+   size_t nombre = nombreSegments(liste1->taille, nombreThreads);
+   // même longueur, empreintes et cas séquentiel : comme sontEgales
+   if (liste1->taille != liste2->taille || nombre == 1) {
+      return sontEgales(liste1, liste2);
+   }
+   if (liste1->empreinte && liste2->empreinte &&
+       valeurEmpreinte(liste1) != valeurEmpreinte(liste2)) {
+      return false;
+   }
+
+   // les deux listes ont la même longueur : leurs segments ont les mêmes positions
+   Element *debuts1[THREADS_MAX];
+   Element *debuts2[THREADS_MAX];
+   SegmentComparaison segments[THREADS_MAX] = {{0}};
+   atomic_bool differentes = false;
+   decouper(liste1, nombre, debuts1);
+   decouper(liste2, nombre, debuts2);
+   for (size_t i = 0; i < nombre; i++) {
+      segments[i].debut1 = debuts1[i];
+      segments[i].debut2 = debuts2[i];
+      segments[i].nombre = (i + 1) * liste1->taille / nombre -
+                           i * liste1->taille / nombre;
+      segments[i].differentes = &differentes;
+   }
+
+   executerEnParallele(comparerSegments, segments, sizeof(SegmentComparaison),
+                       nombre);
+   for (size_t i = 0; i < nombre; i++) {
+      COMPTER_PARCOURUS(segments[i].compares);
+   }
+   return !atomic_load(&differentes);
+}
+
+void *replierSegment(void *argument) {
+   SegmentRepliage *segment = (SegmentRepliage *) argument;
+   const Element *element = segment->debut;
+   for (size_t i = 0; i < segment->nombre; i++) {
+      segment->accumuler(segment->partiel, segment->position + i, &element->info);
+      element = element->suivant;
+   }
+   return NULL;
+}
+
+void replierParallele(const Liste *liste, void *resultat, const void *neutre,
+                      size_t tailleResultat,
+                      void (*accumuler)(void *partiel, size_t position,
+                                        const Info *info),
+                      void (*combiner)(void *resultat, const void *partiel),
+                      size_t nombreThreads) {
+   INSTRUMENTER(REPLIER_PARALLELE);
+   if (!accumuler || !combiner || estVide(liste)) {
+      return;
+   }
+   size_t nombre = nombreSegments(liste->taille, nombreThreads);
+   // le premier segment est accumulé directement dans resultat, les autres dans
+   // des résultats partiels alignés comme la mémoire renvoyée par malloc
+   const size_t alignement = _Alignof(max_align_t);
+   const size_t pas = (tailleResultat + alignement - 1) / alignement * alignement;
+   unsigned char *partiels = NULL;
+   if (nombre > 1 && !(partiels = (unsigned char *) malloc((nombre - 1) * pas))) {
+      // faute de mémoire pour les résultats partiels, repli séquentiel
+      nombre = 1;
+   }
+
+   Element *debuts[THREADS_MAX];
+   SegmentRepliage segments[THREADS_MAX];
+   decouper(liste, nombre, debuts);
+   for (size_t i = 0; i < nombre; i++) {
+      segments[i].accumuler = accumuler;
+      segments[i].debut = debuts[i];
+      segments[i].position = i * liste->taille / nombre;
+      segments[i].nombre = (i + 1) * liste->taille / nombre - segments[i].position;
+      segments[i].partiel = i ? partiels + (i - 1) * pas : resultat;
+      if (i) {
+         memcpy(segments[i].partiel, neutre, tailleResultat);
+      }
+   }
+
+   executerEnParallele(replierSegment, segments, sizeof(SegmentRepliage), nombre);
+   COMPTER_PARCOURUS(liste->taille);
+   // combinaison dans l'ordre des positions
+   for (size_t i = 1; i < nombre; i++) {
+      combiner(resultat, segments[i].partiel);
+   }
+   free(partiels);
+}
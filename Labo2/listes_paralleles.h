@@ -0,0 +1,99 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : listes_paralleles.h
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Traitements parallèles (multi-threads) sur les listes
+                  doublement chaînées non circulaires de listes_dynamiques.h
+
+ Remarque(s)    : Non disponible avec LISTES_DEROULEES.
+                  Les fonctions passées en paramètre sont appelées simultanément
+                  depuis plusieurs threads et doivent donc être réentrantes.
+                  La liste ne doit pas être utilisée par d'autres threads pendant
+                  l'appel.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+
+#ifndef LISTES_PARALLELES_H
+#define LISTES_PARALLELES_H
+
+#include "listes_dynamiques.h"
+
+// Nombre minimal d'éléments confiés à chaque thread : en dessous, le coût de
+// création des threads dépasse le gain et le traitement est séquentiel.
+#define ELEMENTS_MIN_PAR_THREAD 16384
+
+// ------------------------------------------------------------------------------
+// Même résultat que supprimerSelonCritere, mais la liste est découpée en
+// nombreThreads segments consécutifs traités simultanément : chaque thread
+// évalue critere (avec les positions d'origine) sur son segment, y supprime les
+// éléments qui le vérifient, puis les segments conservés sont raccordés.
+// N.B. Le découpage est en O(nombreThreads) si liste dispose d'un index
+// positionnel (cf. activerIndexPositionnel) ou d'un répertoire de segments à
+// jour (cf. activerRepertoireSegments), il nécessite sinon un parcours. Il en va
+// de même pour les traitements en lecture seule ci-dessous.
+void supprimerSelonCritereParallele(Liste *liste,
+                                    bool (*critere)(size_t position,
+                                                    const Info *info),
+                                    size_t nombreThreads);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Même résultat que insererTableauEnQueue (et donc que nombre appels à
+// insererEnQueue avec les infos de tableau, dans l'ordre), mais tableau est
+// découpé en nombreThreads tranches consécutives : chaque thread initialise et
+// chaîne les éléments de sa tranche (et remplit l'index positionnel à leurs
+// positions), puis les tranches sont raccordées en O(nombreThreads).
+// Renvoie OK si l'insertion s'est déroulée avec succès et MEMOIRE_INSUFFISANTE
+// sinon ; la liste n'est alors pas modifiée.
+// N.B. Comme avec insererTableauEnQueue, les éléments proviennent d'un seul bloc
+// contigu si liste a un réservoir ou est vide ; ils sont sinon alloués un à un,
+// par chaque thread pour sa tranche. L'empreinte éventuelle de liste est
+// recalculée lors de la prochaine comparaison.
+Status insererTableauEnQueueParallele(Liste *liste, const Info *tableau,
+                                      size_t nombre, size_t nombreThreads);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie le nombre d'éléments de liste dont l'info vérifie critere (0 si
+// critere vaut NULL). Comme pour supprimerSelonCritereParallele, chaque thread
+// évalue critere (avec les positions des éléments) sur un segment de liste.
+size_t compterSelonCritereParallele(const Liste *liste,
+                                    bool (*critere)(size_t position,
+                                                    const Info *info),
+                                    size_t nombreThreads);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Même résultat que sontEgales, mais les segments de même position des deux
+// listes sont comparés simultanément ; tous les threads s'arrêtent peu après
+// la première différence trouvée.
+bool sontEgalesParallele(const Liste *liste1, const Liste *liste2,
+                         size_t nombreThreads);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Accumule dans resultat toutes les infos de liste, dans l'ordre des positions,
+// comme le feraient les appels accumuler(resultat, position, info) de la tête à
+// la queue. Le premier segment est accumulé dans resultat, chacun des autres
+// dans un résultat partiel de tailleResultat octets initialisé par une copie de
+// neutre ; les résultats partiels sont ensuite intégrés, dans l'ordre des
+// segments, par combiner(resultat, partiel).
+// combiner doit donc produire le même résultat que l'accumulation dans resultat
+// des infos accumulées dans partiel (ex. somme : accumuler ajoute l'info,
+// combiner ajoute le partiel, neutre vaut 0).
+// Rien n'est fait si accumuler ou combiner vaut NULL.
+// N.B. S'il n'y a pas assez de mémoire pour les résultats partiels,
+// l'accumulation est séquentielle.
+void replierParallele(const Liste *liste, void *resultat, const void *neutre,
+                      size_t tailleResultat,
+                      void (*accumuler)(void *partiel, size_t position,
+                                        const Info *info),
+                      void (*combiner)(void *resultat, const void *partiel),
+                      size_t nombreThreads);
+// ------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,213 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : listes_variables.c
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Ce fichier implémente les listes à données de taille variable
+                  (listes_variables.h).
+
+ Remarque(s)    : Aucune vérification sur le pointeur 'liste' passé en paramètre
+                  aux fonctions n'est effectuée
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+#include "listes_variables.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Alloue un element contenant une copie des taille octets de donnees
+ * @param donnees
+ * @param taille
+ * @return l'element, dont les liens sont à NULL, ou NULL en cas de mémoire
+ * insuffisante
+ */
+static ElementVariable *creerElementVariable(const void *donnees, size_t taille);
+
+/**
+ * Copie au plus capacite octets des donnees de element dans donnees puis
+ * restitue element
+ * @param element element déjà détaché de sa liste
+ * @param donnees destination de la copie (NULL : aucune copie)
+ * @param capacite taille de la destination
+ * @param taille taille complète des donnees de l'element (NULL : non renvoyée)
+ */
+static void restituerElementVariable(ElementVariable *element, void *donnees,
+                                     size_t capacite, size_t *taille);
+
+/**
+ * Restitue l'element dont maillon est le lien (fonction retire des listes
+ * intrusives)
+ * @param maillon lien d'un element déjà détaché de sa liste
+ */
+static void restituerMaillon(Maillon *maillon);
+
+/**
+ * Compare les donnees des elements dont maillon1 et maillon2 sont les liens
+ * @param maillon1
+ * @param maillon2
+ * @return true si les donnees ont la même taille et le même contenu
+ */
+static bool donneesEgales(const Maillon *maillon1, const Maillon *maillon2);
+
+/**
+ * Détache de liste son maillon en tête, resp. en queue, puis copie et restitue
+ * l'element correspondant (cf. restituerElementVariable)
+ * @param liste
+ * @param enTete true pour la tête, false pour la queue
+ * @param donnees
+ * @param capacite
+ * @param taille
+ * @return LISTE_VIDE si liste est vide, OK sinon
+ */
+static Status supprimerExtremiteVariable(ListeVariable *liste, bool enTete,
+                                         void *donnees, size_t capacite,
+                                         size_t *taille);
+
+ElementVariable *creerElementVariable(const void *donnees, size_t taille) {
+   if (taille > SIZE_MAX - sizeof(ElementVariable)) {
+      return NULL;
+   }
+   // une seule allocation pour les liens et les donnees
+   ElementVariable *element =
+      (ElementVariable *) malloc(sizeof(ElementVariable) + taille);
+   if (!element) {
+      return NULL;
+   }
+   element->lien = (Maillon) {NULL, NULL};
+   element->taille = taille;
+   if (taille) {
+      memcpy(element->donnees, donnees, taille);
+   }
+   return element;
+}
+
+void restituerElementVariable(ElementVariable *element, void *donnees,
+                              size_t capacite, size_t *taille) {
+   if (donnees) {
+      memcpy(donnees, element->donnees,
+             element->taille < capacite ? element->taille : capacite);
+   }
+   if (taille) {
+      *taille = element->taille;
+   }
+   free(element);
+}
+
+void restituerMaillon(Maillon *maillon) {
+   free(CONTENEUR(maillon, ElementVariable, lien));
+}
+
+bool donneesEgales(const Maillon *maillon1, const Maillon *maillon2) {
+   const ElementVariable *element1 = CONTENEUR(maillon1, const ElementVariable, lien);
+   const ElementVariable *element2 = CONTENEUR(maillon2, const ElementVariable, lien);
+   return element1->taille == element2->taille &&
+          memcmp(element1->donnees, element2->donnees, element1->taille) == 0;
+}
+
+Status supprimerExtremiteVariable(ListeVariable *liste, bool enTete,
+                                  void *donnees, size_t capacite,
+                                  size_t *taille) {
+   Maillon *maillon;
+   Status status = enTete ? supprimerEnTeteIntrusive(&liste->liens, &maillon)
+                          : supprimerEnQueueIntrusive(&liste->liens, &maillon);
+   if (status == OK) {
+      restituerElementVariable(CONTENEUR(maillon, ElementVariable, lien), donnees,
+                               capacite, taille);
+   }
+   return status;
+}
+
+ListeVariable *initialiserVariable(void) {
+   ListeVariable *liste = (ListeVariable *) malloc(sizeof(ListeVariable));
+   if (liste) {
+      initialiserIntrusive(&liste->liens);
+   }
+   return liste;
+}
+
+bool estVideVariable(const ListeVariable *liste) {
+   return estVideIntrusive(&liste->liens);
+}
+
+size_t longueurVariable(const ListeVariable *liste) {
+   return longueurIntrusive(&liste->liens);
+}
+
+Status insererEnTeteVariable(ListeVariable *liste, const void *donnees,
+                             size_t taille) {
+   ElementVariable *element = creerElementVariable(donnees, taille);
+   if (!element) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+   insererEnTeteIntrusive(&liste->liens, &element->lien);
+   return OK;
+}
+
+Status insererEnQueueVariable(ListeVariable *liste, const void *donnees,
+                              size_t taille) {
+   ElementVariable *element = creerElementVariable(donnees, taille);
+   if (!element) {
+      return MEMOIRE_INSUFFISANTE;
+   }
+   insererEnQueueIntrusive(&liste->liens, &element->lien);
+   return OK;
+}
+
+Status supprimerEnTeteVariable(ListeVariable *liste, void *donnees,
+                               size_t capacite, size_t *taille) {
+   return supprimerExtremiteVariable(liste, true, donnees, capacite, taille);
+}
+
+Status supprimerEnQueueVariable(ListeVariable *liste, void *donnees,
+                                size_t capacite, size_t *taille) {
+   return supprimerExtremiteVariable(liste, false, donnees, capacite, taille);
+}
+
+Status elementAVariable(const ListeVariable *liste, size_t position,
+                        ElementVariable **element) {
+   Maillon *maillon = maillonAIntrusive(&liste->liens, position);
+   if (!maillon) {
+      return POSITION_NON_VALIDE;
+   }
+   *element = CONTENEUR(maillon, ElementVariable, lien);
+   return OK;
+}
+
+void supprimerSelonCritereVariable(ListeVariable *liste,
+                                   bool (*critere)(size_t position,
+                                                   const void *donnees,
+                                                   size_t taille)) {
+   if (!critere) {
+      return;
+   }
+   size_t position = 0;
+   Maillon *maillon = liste->liens.tete;
+   while (maillon) {
+      Maillon *suivant = maillon->suivant;
+      const ElementVariable *element = CONTENEUR(maillon, ElementVariable, lien);
+      if (critere(position++, element->donnees, element->taille)) {
+         retirerIntrusive(&liste->liens, maillon);
+         restituerMaillon(maillon);
+      }
+      maillon = suivant;
+   }
+}
+
+void viderVariable(ListeVariable *liste, size_t position) {
+   viderIntrusive(&liste->liens, position, restituerMaillon);
+}
+
+bool sontEgalesVariables(const ListeVariable *liste1, const ListeVariable *liste2) {
+   return sontEgalesIntrusives(&liste1->liens, &liste2->liens, donneesEgales);
+}
+
+void detruireVariable(ListeVariable *liste) {
+   if (liste) {
+      viderVariable(liste, 0);
+      free(liste);
+   }
+}
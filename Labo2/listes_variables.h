@@ -0,0 +1,151 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : listes_variables.h
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Listes doublement chaînées non circulaires dont chaque élément
+                  contient des données de taille variable (chaîne de caractères,
+                  enregistrement...), placées à la fin de l'élément.
+
+ Remarque(s)    : Un élément et ses données sont alloués en une seule fois :
+                  les données sont copiées lors de l'insertion et sont contiguës
+                  aux liens de l'élément. Les données sont alignées comme la
+                  mémoire renvoyée par malloc.
+                  Les liens d'un élément sont un Maillon : le chaînage, le
+                  parcours positionnel, vider et la comparaison sont ceux des
+                  listes intrusives (listes_intrusives.h) ; seuls l'allocation
+                  des éléments et la copie des données sont propres à ce module.
+                  Disponible avec les deux représentations de liste.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+
+#ifndef LISTES_VARIABLES_H
+#define LISTES_VARIABLES_H
+
+#include "listes_intrusives.h"
+#include <stddef.h>
+
+typedef struct {
+   Maillon lien;
+   size_t taille;                // nombre d'octets de donnees
+   _Alignas(max_align_t) unsigned char donnees[];
+} ElementVariable;
+
+typedef struct {
+   ListeIntrusive liens;
+} ListeVariable;
+
+// ------------------------------------------------------------------------------
+// Initialisation de la liste.
+// N.B. Cette fonction doit obligatoirement être utilisée pour se créer une liste
+// car elle garantit l'initialisation des liens de la liste
+// Renvoie NULL en cas de mémoire insuffisante
+ListeVariable *initialiserVariable(void);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie true si liste est vide, false sinon.
+bool estVideVariable(const ListeVariable *liste);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie combien il y a d'éléments dans liste, en O(1).
+size_t longueurVariable(const ListeVariable *liste);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie l'élément en tête, resp. en queue, de liste, ou NULL si elle est vide.
+static inline ElementVariable *premierVariable(const ListeVariable *liste) {
+   return liste->liens.tete ? CONTENEUR(liste->liens.tete, ElementVariable, lien)
+                            : NULL;
+}
+static inline ElementVariable *dernierVariable(const ListeVariable *liste) {
+   return liste->liens.queue ? CONTENEUR(liste->liens.queue, ElementVariable, lien)
+                             : NULL;
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie l'élément suivant, resp. précédent, element dans sa liste, ou NULL si
+// element en est la queue, resp. la tête.
+static inline ElementVariable *suivantVariable(const ElementVariable *element) {
+   return element->lien.suivant ? CONTENEUR(element->lien.suivant, ElementVariable,
+                                            lien)
+                                : NULL;
+}
+static inline ElementVariable *precedentVariable(const ElementVariable *element) {
+   return element->lien.precedent ? CONTENEUR(element->lien.precedent,
+                                              ElementVariable, lien)
+                                  : NULL;
+}
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Insère, en tête, resp. en queue, de liste un nouvel élément contenant une copie
+// des taille octets pointés par donnees (donnees peut valoir NULL si taille vaut
+// 0).
+// Renvoie OK si l'insertion s'est déroulée avec succès et MEMOIRE_INSUFFISANTE
+// s'il n'y a pas assez de mémoire pour créer le nouvel élément.
+// Exemple : insererEnQueueVariable(liste, nom, strlen(nom) + 1);
+Status insererEnTeteVariable(ListeVariable *liste, const void *donnees,
+                             size_t taille);
+Status insererEnQueueVariable(ListeVariable *liste, const void *donnees,
+                              size_t taille);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Copie dans donnees (si ce paramètre ne vaut pas NULL) au plus capacite octets
+// des données de l'élément en tête, resp. en queue, de liste, renvoie via le
+// paramètre taille (s'il ne vaut pas NULL) leur taille complète, puis supprime,
+// en restituant la mémoire allouée, ledit élément.
+// Renvoie LISTE_VIDE si la liste passée en paramètre est vide, OK sinon.
+Status supprimerEnTeteVariable(ListeVariable *liste, void *donnees,
+                               size_t capacite, size_t *taille);
+Status supprimerEnQueueVariable(ListeVariable *liste, void *donnees,
+                                size_t capacite, size_t *taille);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie, via le paramètre element, l'élément se trouvant à la position
+// position de liste, dont les données sont lisibles et modifiables en place
+// (element->donnees, element->taille octets).
+// Renvoie POSITION_NON_VALIDE si la position est non valide, OK sinon.
+// N.B. Le parcours part de l'extrémité la plus proche de position.
+Status elementAVariable(const ListeVariable *liste, size_t position,
+                        ElementVariable **element);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Supprime, en restituant la mémoire allouée, les éléments de liste dont les
+// données vérifient critere.
+void supprimerSelonCritereVariable(ListeVariable *liste,
+                                   bool (*critere)(size_t position,
+                                                   const void *donnees,
+                                                   size_t taille));
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Supprime, en restituant la mémoire allouée, tous les éléments de liste à partir
+// de la position position.
+// N.B. Vider à partir de la position 0 signifie vider toute la liste.
+void viderVariable(ListeVariable *liste, size_t position);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie true si liste1 et liste2 ont la même longueur et si les éléments de
+// même position ont des données de même taille et de même contenu (octet par
+// octet), false sinon.
+// N.B. 2 listes vides sont considérées comme égales.
+bool sontEgalesVariables(const ListeVariable *liste1, const ListeVariable *liste2);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Supprime, en restituant la mémoire allouée, tous les éléments de liste puis
+// liste elle-même.
+void detruireVariable(ListeVariable *liste);
+// ------------------------------------------------------------------------------
+
+#endif
@@ -15,8 +15,35 @@
 */
 #include <assert.h>
 #include <stdio.h>
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include "listes_dynamiques.h"
+#include "deque_concurrente.h"
+#include "deque_vol.h"
+#include "listes_intrusives.h"
+#include "persistance.h"
+#include "instrumentation.h"
+#include "listes_generiques.h"
+#include "listes_variables.h"
+
+#ifndef LISTES_DEROULEES
+#include "listes_paralleles.h"
+#include "restitution_differee.h"
+#endif
+
+// Acces aux infos de tete et de queue, quelle que soit la représentation
+#ifdef LISTES_DEROULEES
+#define INFO_TETE(liste) ((liste)->tete->infos[(liste)->tete->debut])
+#define INFO_QUEUE(liste) \
+   ((liste)->queue->infos[(liste)->queue->debut + (liste)->queue->nombre - 1])
+#else
+#define INFO_TETE(liste) ((liste)->tete->info)
+#define INFO_QUEUE(liste) ((liste)->queue->info)
+#endif
 
 /**
  * Fonction qui affiche le test qui a été passé
@@ -71,6 +98,349 @@ void testSupprimerSelonCritere(void);
  */
 void testSontEgales(void);
 
+/**
+ * Fonction qui teste les fonctions de notre liste dynamique sur une liste
+ * occupant de nombreux elements (plusieurs elements par bloc pour une liste
+ * déroulée)
+ */
+void testGrandeListe(void);
+
+/**
+ * Fonction qui teste la fonction elementA de notre liste dynamique
+ */
+void testElementA(void);
+
+/**
+ * Fonction qui teste les fonctions afficherDans et formaterDansTampon de notre
+ * liste dynamique en comparant leur texte à celui produit par printf
+ */
+void testAfficherDans(void);
+
+/**
+ * Fonction qui teste les fonctions insererTableauEnQueue, insererTableauEnTete
+ * et versTableau de notre liste dynamique
+ */
+void testTableaux(void);
+
+/**
+ * Fonction qui teste les fonctions concatener, couperA et transfererPlage de
+ * notre liste dynamique
+ */
+void testConcatenerCouper(void);
+
+/**
+ * Fonction qui teste les fonctions sauvegarder, charger et projeter de notre
+ * liste dynamique, ainsi que le rejet de fichiers non valides
+ */
+void testPersistance(void);
+
+// Fichier écrit (puis supprimé) par testPersistance pour tester projeter
+#define FICHIER_TEST_PERSISTANCE "test_persistance.bin"
+
+/**
+ * Fonction qui teste les compteurs de l'instrumentation : appels, elements
+ * parcourus et allocations si la librairie est instrumentée, compteurs nuls
+ * sinon
+ */
+void testInstrumentation(void);
+
+/**
+ * Fonction qui teste la deque concurrente, depuis un puis plusieurs threads
+ */
+void testDequeConcurrente(void);
+
+// Nombre d'infos insérées par chaque producteur de testDequeConcurrente
+#define INFOS_PAR_PRODUCTEUR 20000
+
+/**
+ * Travail d'un thread de testDequeConcurrente
+ */
+typedef struct {
+   DequeConcurrente *deque;
+   bool enTete;       // extrémité à laquelle le thread travaille
+   long long somme;   // somme des infos retirées (consommateurs)
+} TravailDeque;
+
+/**
+ * Insère INFOS_PAR_PRODUCTEUR infos (1, 2, ...) dans la deque
+ * @param argument TravailDeque
+ * @return NULL
+ */
+void *produire(void *argument);
+
+/**
+ * Retire, en attendant si nécessaire, INFOS_PAR_PRODUCTEUR infos de la deque
+ * et en calcule la somme
+ * @param argument TravailDeque
+ * @return NULL
+ */
+void *consommer(void *argument);
+
+/**
+ * Fonction qui teste la deque de vol de travail, depuis un puis plusieurs
+ * threads
+ */
+void testDequeVol(void);
+
+// Nombre d'infos insérées par le propriétaire dans testDequeVol
+#define INFOS_DEQUE_VOL 100000
+
+/**
+ * Travail d'un voleur de testDequeVol
+ */
+typedef struct {
+   DequeVol *deque;
+   atomic_bool *fini;   // true une fois que le propriétaire a vidé sa deque
+   long long somme;     // somme des infos volées
+   size_t nombre;       // nombre d'infos volées
+} TravailVoleur;
+
+/**
+ * Vole des infos dans la deque jusqu'à ce que le propriétaire ait fini
+ * @param argument TravailVoleur
+ * @return NULL
+ */
+void *voler(void *argument);
+
+/**
+ * Fonction qui teste les listes intrusives
+ */
+void testListeIntrusive(void);
+
+/**
+ * Structure de l'appelant chaînée par une liste intrusive dans
+ * testListeIntrusive
+ */
+typedef struct {
+   int valeur;
+   Maillon lien;
+   bool retire;         // mis à true par marquerRetire
+} Enregistrement;
+
+/**
+ * Critere de liste intrusive
+ * @param pos position dans la liste
+ * @param maillon lien d'un Enregistrement
+ * @return true si la valeur de l'enregistrement est impaire
+ */
+bool valeurEstImpaire(size_t pos, const Maillon *maillon);
+
+/**
+ * Marque l'enregistrement d'un maillon retiré d'une liste intrusive
+ * @param maillon lien d'un Enregistrement
+ */
+void marquerRetire(Maillon *maillon);
+
+/**
+ * @param maillon1 lien d'un Enregistrement
+ * @param maillon2 lien d'un Enregistrement
+ * @return true si les deux enregistrements ont la même valeur
+ */
+bool memesValeurs(const Maillon *maillon1, const Maillon *maillon2);
+
+/**
+ * Fonction qui teste les listes à données de taille variable
+ */
+void testListeVariable(void);
+
+/**
+ * Critere de liste à données de taille variable
+ * @param pos position dans la liste
+ * @param donnees chaîne de caractères terminée par '\0'
+ * @param taille taille de donnees
+ * @return true si la chaîne commence par 'P'
+ */
+bool commenceParP(size_t pos, const void *donnees, size_t taille);
+
+/**
+ * Fonction qui teste les listes générées par CREER_LISTE_GENERIQUE, de réels et
+ * de structures
+ */
+void testListesGeneriques(void);
+
+/**
+ * Structure contenue directement dans les elements d'une ListeNavires
+ */
+typedef struct {
+   char nom[16];
+   double taxe;
+} Navire;
+
+/**
+ * @param navire1
+ * @param navire2
+ * @return true si les deux navires ont le même nom et la même taxe
+ */
+bool naviresEgaux(const Navire *navire1, const Navire *navire2);
+
+/**
+ * Critere de ListeReels
+ * @param pos position dans la liste
+ * @param reel valeur de l'element à la position pos
+ * @return true si reel est négatif
+ */
+bool reelEstNegatif(size_t pos, const double *reel);
+
+CREER_LISTE_GENERIQUE(ListeReels, double, VALEURS_EGALES)
+
+CREER_LISTE_GENERIQUE(ListeNavires, Navire, naviresEgaux)
+
+/**
+ * Vérifie que liste contient exactement les nombre infos de attendu, en la
+ * parcourant dans les deux sens
+ * @param liste liste à vérifier
+ * @param attendu infos attendues, de la tete à la queue
+ * @param nombre nombre d'infos attendues
+ */
+void verifierContenu(const Liste *liste, const Info *attendu, size_t nombre);
+
+#ifndef LISTES_DEROULEES
+/**
+ * Fonction qui teste les listes utilisant un reservoir d'elements
+ */
+void testReservoir(void);
+
+/**
+ * Fonction qui teste l'index positionnel de notre liste dynamique
+ */
+void testIndexPositionnel(void);
+
+/**
+ * Fonction qui teste la fonction supprimerSelonCritereParLot de notre liste
+ * dynamique
+ */
+void testSupprimerSelonCritereParLot(void);
+
+/**
+ * Fonction qui teste la fonction supprimerSelonCritereParallele
+ */
+void testSupprimerSelonCritereParallele(void);
+
+/**
+ * Fonction qui teste la fonction insererTableauEnQueueParallele
+ */
+void testInsererTableauEnQueueParallele(void);
+
+/**
+ * Fonction qui teste le répertoire de segments et les traitements parallèles en
+ * lecture seule (compter, comparer, replier), au fil des modifications de la
+ * liste
+ */
+void testRepertoireSegments(void);
+
+/**
+ * Vérifie que compterSelonCritereParallele, replierParallele et
+ * sontEgalesParallele donnent sur liste les résultats calculés séquentiellement
+ * sur attendue
+ * @param liste liste traitée en parallèle
+ * @param attendue liste de même contenu
+ */
+void verifierTraitementsParalleles(const Liste *liste, const Liste *attendue);
+
+/**
+ * Accumulation de replierParallele : ajoute (position + 1) * info à la somme
+ * @param partiel uint64_t contenant la somme
+ * @param position position de l'info
+ * @param info
+ */
+void accumulerSommePonderee(void *partiel, size_t position, const Info *info);
+
+/**
+ * Combinaison de replierParallele : ajoute une somme partielle à la somme
+ * @param resultat uint64_t contenant la somme
+ * @param partiel uint64_t contenant la somme partielle
+ */
+void combinerSommes(void *resultat, const void *partiel);
+
+/**
+ * Fonction qui teste l'empreinte utilisée par sontEgales
+ */
+void testEmpreinte(void);
+
+/**
+ * Fonction qui teste les curseurs, avec et sans index positionnel
+ */
+void testCurseur(void);
+
+/**
+ * Fonction qui teste le tri de notre liste dynamique, avec et sans comparateur
+ */
+void testTrier(void);
+
+/**
+ * Fonction qui teste la restitution différée, par l'appelant puis en
+ * arrière-plan
+ */
+void testRestitutionDifferee(void);
+
+/**
+ * Fonction qui teste le compactage d'une liste, avec et sans reservoir partagé
+ */
+void testCompacter(void);
+
+/**
+ * Fonction qui teste les caches d'elements par thread, depuis un puis plusieurs
+ * threads
+ */
+void testCachesElements(void);
+
+/**
+ * Travail d'un thread de testCachesElements : insertions et suppressions
+ * entremêlées en tete et en queue d'une liste propre au thread
+ * @param argument pointeur sur un long long recevant la somme des infos
+ * restantes (-1 en cas d'incohérence)
+ * @return NULL
+ */
+void *modifierListeDuThread(void *argument);
+
+/**
+ * Travail d'un thread de testCachesElements qui ne fait qu'allouer : une
+ * insertion en queue d'une liste
+ * @param argument la Liste (sans reservoir) à compléter
+ * @return NULL
+ */
+void *insererDepuisUnThread(void *argument);
+
+/**
+ * Comparateur ne tenant compte que de la clé (info / 100000) des infos, pour
+ * vérifier la stabilité du tri
+ * @param info1
+ * @param info2
+ * @return négatif, nul ou positif selon que la clé de info1 est inférieure,
+ * égale ou supérieure à celle de info2
+ */
+int comparerCles(const Info *info1, const Info *info2);
+
+/**
+ * Critere dependant à la fois de la position et de l'info, pour verifier que
+ * les positions transmises par les traitements parallèles sont correctes
+ * @param pos position dans la liste
+ * @param val valeur de l'element dans la position pos de la liste
+ * @return true si pos + val est multiple de 3
+ */
+bool positionPlusInfoMultipleDe3(size_t pos, const Info *val);
+
+/**
+ * Version par lot de estEntre3et7
+ * @param positionDebut position de la premiere info du lot
+ * @param infos infos du lot
+ * @param nombre nombre d'infos du lot
+ * @param aSupprimer true pour chaque info qui n'est pas comprise entre 3 et 7
+ */
+void estEntre3et7ParLot(size_t positionDebut, const Info *infos, size_t nombre,
+                        bool *aSupprimer);
+
+/**
+ * Version par lot de positionEstPaire
+ * @param positionDebut position de la premiere info du lot
+ * @param infos infos du lot
+ * @param nombre nombre d'infos du lot
+ * @param aSupprimer true pour chaque info dont la position est paire
+ */
+void positionEstPaireParLot(size_t positionDebut, const Info *infos, size_t nombre,
+                            bool *aSupprimer);
+#endif
+
 /**
  * Fonction pour tester la suppression selon critere de notre liste dynamique
  * @param pos position dans la liste
@@ -106,6 +476,32 @@ int main(void) {
    testVider();
    testSupprimerSelonCritere();
    testSontEgales();
+   testGrandeListe();
+   testElementA();
+   testAfficherDans();
+   testTableaux();
+   testConcatenerCouper();
+   testPersistance();
+   testInstrumentation();
+   testDequeConcurrente();
+   testDequeVol();
+   testListeIntrusive();
+   testListesGeneriques();
+   testListeVariable();
+#ifndef LISTES_DEROULEES
+   testReservoir();
+   testIndexPositionnel();
+   testSupprimerSelonCritereParLot();
+   testSupprimerSelonCritereParallele();
+   testInsererTableauEnQueueParallele();
+   testRepertoireSegments();
+   testEmpreinte();
+   testCurseur();
+   testTrier();
+   testRestitutionDifferee();
+   testCompacter();
+   testCachesElements();
+#endif
 }
 
 void afficherTestOk(const char *test) {
@@ -128,7 +524,7 @@ void testInsererEtSupprimerEnTete(void) {
    Info info1 = 42;
    assert(insererEnTete(liste, &info1) == OK);
    assert(liste->tete != NULL);
-   assert(liste->tete->info == info1);
+   assert(INFO_TETE(liste) == info1);
    assert(liste->queue == liste->tete);
    afficherTestOk("Test insererEnTete(), liste vide");
 
@@ -144,18 +540,21 @@ void testInsererEtSupprimerEnTete(void) {
    assert(insererEnTete(liste, &info1) == OK);
    assert(insererEnTete(liste, &info2) == OK);
    // pas besoin de verifier liste->tete, ça a deja ete teste
+   assert(INFO_QUEUE(liste) == info1);
+#ifndef LISTES_DEROULEES
    assert(liste->tete->suivant != NULL);
    assert(liste->tete->suivant->info == info1);
    assert(liste->queue == liste->tete->suivant);
    assert(liste->queue->precedent != NULL);
    assert(liste->queue->precedent == liste->tete);
+#endif
    afficherTestOk("Test insererEnTete(), liste non vide");
 
    Info infoObtenue2;
    assert(supprimerEnTete(liste, &infoObtenue2) == OK);
    assert(infoObtenue2 == info2);
    assert(liste->tete != NULL);
-   assert(liste->tete->info == info1);
+   assert(INFO_TETE(liste) == info1);
    assert(liste->tete->suivant == NULL);
    assert(liste->queue == liste->tete);
 
@@ -167,7 +566,7 @@ void testInsererEtSupprimerEnTete(void) {
 
    //test 3. Insertion avec ptr null
    assert(insererEnTete(liste, NULL) == OK);
-   assert(liste->tete->info == 0);
+   assert(INFO_TETE(liste) == 0);
    afficherTestOk("Test insererEnTete(), pointeur NULL");
    assert(supprimerEnTete(liste, NULL) == OK);
 
@@ -248,7 +647,7 @@ void testInsererEtSupprimerEnQueue(void) {
    Info info1 = 42;
    assert(insererEnQueue(liste, &info1) == OK);
    assert(liste->tete != NULL);
-   assert(liste->tete->info == info1);
+   assert(INFO_TETE(liste) == info1);
    assert(liste->queue == liste->tete);
    afficherTestOk("Test insererEnQueue(), liste vide");
 
@@ -263,19 +662,22 @@ void testInsererEtSupprimerEnQueue(void) {
    Info info2 = 84;
    assert(insererEnQueue(liste, &info1) == OK);
    assert(insererEnQueue(liste, &info2) == OK);
+   assert(INFO_TETE(liste) == info1);
+   assert(INFO_QUEUE(liste) == info2);
+#ifndef LISTES_DEROULEES
    assert(liste->tete->suivant != NULL);
-   assert(liste->tete->info == info1);
    assert(liste->tete->suivant->info == info2);
    assert(liste->queue == liste->tete->suivant);
    assert(liste->queue->precedent != NULL);
    assert(liste->queue->precedent == liste->tete);
+#endif
    afficherTestOk("Test insererEnQueue(), liste non vide");
 
    Info infoObtenue2;
    assert(supprimerEnQueue(liste, &infoObtenue2) == OK);
    assert(infoObtenue2 == info2);
    assert(liste->tete != NULL);
-   assert(liste->tete->info == info1);
+   assert(INFO_TETE(liste) == info1);
    assert(liste->tete->suivant == NULL);
    assert(liste->queue == liste->tete);
 
@@ -287,7 +689,7 @@ void testInsererEtSupprimerEnQueue(void) {
 
    //test 3. Insertion avec ptr null
    assert(insererEnQueue(liste, NULL) == OK);
-   assert(liste->tete->info == 0);
+   assert(INFO_TETE(liste) == 0);
    afficherTestOk("Test insererEnQueue(), pointeur NULL");
    assert(supprimerEnQueue(liste, NULL) == OK);
    assert(liste->tete == NULL);
@@ -309,15 +711,15 @@ void testVider(void) {
    // Test 1 vider moitié
    vider(liste, LONGUEUR / 2lu);
    assert(longueur(liste) == LONGUEUR / 2lu);
-   assert(liste->queue->info == 9);
-   assert(liste->tete->info == 0);
+   assert(INFO_QUEUE(liste) == 9);
+   assert(INFO_TETE(liste) == 0);
    afficherTestOk("Test vider(), moitie");
 
    // Test 2 vider a partir de position non valable
    vider(liste, LONGUEUR / 2);
    assert(longueur(liste) == 10);
-   assert(liste->queue->info == 9);
-   assert(liste->tete->info == 0);
+   assert(INFO_QUEUE(liste) == 9);
+   assert(INFO_TETE(liste) == 0);
    afficherTestOk("Test vider(), position non valable");
 
    // Test 3 vider tout
@@ -328,6 +730,23 @@ void testVider(void) {
    assert(liste->queue == NULL);
    afficherTestOk("Test vider(), tout");
 
+   // Test 4 vider dans la moitié la plus proche de la queue (liste déroulée :
+   // au milieu ou à la limite d'un element)
+   Info attendu[100];
+   for (Info i = 0; i < 100; i++) {
+      attendu[i] = i;
+      assert(insererEnQueue(liste, &i) == OK);
+   }
+   vider(liste, 97);
+   verifierContenu(liste, attendu, 97);
+   vider(liste, 78);
+   verifierContenu(liste, attendu, 78);
+   vider(liste, 51);
+   verifierContenu(liste, attendu, 51);
+   vider(liste, 0);
+   assert(estVide(liste) && liste->queue == NULL);
+   afficherTestOk("Test vider(), depuis la queue");
+
    free(liste);
 }
 
@@ -338,8 +757,8 @@ void testSupprimerSelonCritere(void) {
       insererEnQueue(liste, &i);
    }
    supprimerSelonCritere(liste, estEntre3et7);
-   assert(liste->tete->info == 3);
-   assert(liste->queue->info == 7);
+   assert(INFO_TETE(liste) == 3);
+   assert(INFO_QUEUE(liste) == 7);
    assert(longueur(liste) == 5);
    afficherTestOk("Test supprimer selon critere (info)");
    vider(liste, 0);
@@ -348,8 +767,8 @@ void testSupprimerSelonCritere(void) {
       insererEnQueue(liste, &i);
    }
    supprimerSelonCritere(liste, positionEstPaire);
-   assert(liste->tete->info == 1);
-   assert(liste->queue->info == 9);
+   assert(INFO_TETE(liste) == 1);
+   assert(INFO_QUEUE(liste) == 9);
    assert(longueur(liste) == 5);
    afficherTestOk("Test supprimer selon critere (position)");
 
@@ -410,18 +829,1921 @@ void testSontEgales(void) {
    free(l2);
 }
 
-bool estEntre3et7(size_t pos, const Info *val) {
-   (void) pos; //eviter le warning de parametre non utilise
-   return *val < 3 || *val > 7;
+void testGrandeListe(void) {
+   const int LONGUEUR = 100;
+   Liste *l1 = initialiser();
+   Liste *l2 = initialiser();
+   assert(l1 != NULL);
+   assert(l2 != NULL);
+
+   // memes infos inserées par la queue dans l1 et par la tete dans l2
+   for (int i = 0; i < LONGUEUR; i++) {
+      Info aux = LONGUEUR - 1 - i;
+      assert(insererEnQueue(l1, &i) == OK);
+      assert(insererEnTete(l2, &aux) == OK);
+   }
+   assert(longueur(l1) == (size_t) LONGUEUR);
+   assert(sontEgales(l1, l2));
+   afficherTestOk("Test grande liste, insertion");
+
+   Info info;
+   assert(supprimerEnTete(l1, &info) == OK);
+   assert(info == 0);
+   assert(supprimerEnQueue(l2, &info) == OK);
+   assert(info == LONGUEUR - 1);
+   assert(!sontEgales(l1, l2));
+   assert(insererEnTete(l1, NULL) == OK);
+   info = LONGUEUR - 1;
+   assert(insererEnQueue(l2, &info) == OK);
+   assert(sontEgales(l1, l2));
+   afficherTestOk("Test grande liste, suppression en tete et en queue");
+
+   // les positions paires sont supprimées : il reste les infos impaires
+   supprimerSelonCritere(l1, positionEstPaire);
+   assert(longueur(l1) == (size_t) LONGUEUR / 2);
+   for (int i = 1; i < LONGUEUR; i += 2) {
+      assert(supprimerEnTete(l1, &info) == OK);
+      assert(info == i);
+   }
+   assert(estVide(l1));
+   afficherTestOk("Test grande liste, supprimer selon critere");
+
+   vider(l2, 60);
+   assert(longueur(l2) == 60);
+   assert(supprimerEnQueue(l2, &info) == OK);
+   assert(info == 59);
+   vider(l2, 26);
+   assert(longueur(l2) == 26);
+   vider(l2, 0);
+   assert(estVide(l2));
+   afficherTestOk("Test grande liste, vider");
+
+   free(l1);
+   free(l2);
 }
 
-bool positionEstPaire(size_t pos, const Info *val) {
-   (void) val; //eviter le warning de parametre non utilise
-   return pos % 2 == 0;
+void testElementA(void) {
+   Liste *liste = initialiser();
+   assert(liste != NULL);
+   Info info;
+   assert(elementA(liste, 0, &info) == POSITION_NON_VALIDE);
+
+   for (int i = 0; i < 50; i++) {
+      assert(insererEnQueue(liste, &i) == OK);
+   }
+   assert(elementA(liste, 0, &info) == OK);
+   assert(info == 0);
+   assert(elementA(liste, 37, &info) == OK);
+   assert(info == 37);
+   // de part et d'autre du milieu : parcours depuis la tete puis depuis la queue
+   assert(elementA(liste, 24, &info) == OK);
+   assert(info == 24);
+   assert(elementA(liste, 25, &info) == OK);
+   assert(info == 25);
+   assert(elementA(liste, 49, NULL) == OK);
+   assert(elementA(liste, 50, &info) == POSITION_NON_VALIDE);
+   afficherTestOk("Test elementA()");
+
+   vider(liste, 0);
+   free(liste);
 }
 
-bool suppressionComplete(size_t pos, const Info *val) {
-   (void) pos; //eviter le warning de parametre non utilise
-   (void) val;
-   return true;
+void testAfficherDans(void) {
+   Liste *liste = initialiser();
+   assert(liste != NULL);
+   char chaine[64];
+   assert(formaterDansTampon(chaine, sizeof(chaine), liste, FORWARD) == 2);
+   assert(strcmp(chaine, "[]") == 0);
+
+   Info infos[] = {0, -7, 42, INT_MAX, INT_MIN};
+   for (size_t i = 0; i < sizeof(infos) / sizeof(Info); i++) {
+      assert(insererEnQueue(liste, &infos[i]) == OK);
+   }
+   const char *enAvant = "[0,-7,42,2147483647,-2147483648]";
+   const char *enArriere = "[-2147483648,2147483647,42,-7,0]";
+   assert(formaterDansTampon(chaine, sizeof(chaine), liste, BACKWARD) ==
+          strlen(enArriere));
+   assert(strcmp(chaine, enArriere) == 0);
+
+   // tampon trop petit : texte tronqué et longueur complete renvoyée
+   char petit[8];
+   assert(formaterDansTampon(petit, sizeof(petit), liste, FORWARD) ==
+          strlen(enAvant));
+   assert(strcmp(petit, "[0,-7,4") == 0);
+   assert(formaterDansTampon(NULL, 0, liste, FORWARD) == strlen(enAvant));
+
+   // texte plus grand que le tampon d'afficherDans, comparé à printf
+   vider(liste, 0);
+   for (int i = -20000; i < 20000; i++) {
+      assert(insererEnQueue(liste, &i) == OK);
+   }
+   char *attendu = (char *) malloc(40000 * 8);
+   char *obtenu = (char *) malloc(40000 * 8);
+   assert(attendu != NULL);
+   assert(obtenu != NULL);
+   Mode modes[] = {FORWARD, BACKWARD};
+   for (size_t m = 0; m < 2; m++) {
+      size_t tailleTexte = (size_t) sprintf(attendu, "[");
+      for (int i = 0; i < 40000; i++) {
+         int info = modes[m] == FORWARD ? i - 20000 : 19999 - i;
+         tailleTexte += (size_t) sprintf(attendu + tailleTexte, i ? ",%d" : "%d",
+                                         info);
+      }
+      tailleTexte += (size_t) sprintf(attendu + tailleTexte, "]");
+
+      assert(formaterDansTampon(obtenu, 40000 * 8, liste, modes[m]) == tailleTexte);
+      assert(strcmp(obtenu, attendu) == 0);
+
+      FILE *flux = tmpfile();
+      assert(flux != NULL);
+      afficherDans(flux, liste, modes[m]);
+      assert((size_t) ftell(flux) == tailleTexte);
+      rewind(flux);
+      assert(fread(obtenu, 1, tailleTexte, flux) == tailleTexte);
+      assert(memcmp(obtenu, attendu, tailleTexte) == 0);
+      fclose(flux);
+   }
+   afficherTestOk("Test afficherDans(), formaterDansTampon()");
+
+   free(attendu);
+   free(obtenu);
+   detruire(liste);
+}
+
+void verifierContenu(const Liste *liste, const Info *attendu, size_t nombre) {
+   assert(longueur(liste) == nombre);
+   Info *infos = (Info *) malloc((nombre + 1) * sizeof(Info));
+   assert(infos != NULL);
+   assert(versTableau(liste, infos, nombre + 1) == nombre);
+   for (size_t i = 0; i < nombre; i++) {
+      assert(infos[i] == attendu[i]);
+      Info info;
+      // elementA parcourt depuis la queue pour la seconde moitié
+      assert(elementA(liste, i, &info) == OK);
+      assert(info == attendu[i]);
+   }
+   free(infos);
+}
+
+void testTableaux(void) {
+   Info tableau[100];
+   Info attendu[300];
+   for (int i = 0; i < 100; i++) {
+      tableau[i] = i;
+   }
+
+   Liste *liste = initialiser();
+   assert(liste != NULL);
+   assert(insererTableauEnQueue(liste, tableau, 0) == OK);
+   assert(insererTableauEnTete(liste, NULL, 0) == OK);
+   assert(estVide(liste));
+   assert(versTableau(liste, attendu, 300) == 0);
+
+   // [0..99] puis 3 infos en queue, 57 en tete et 5 zeros en tete
+   assert(insererTableauEnQueue(liste, tableau, 100) == OK);
+   assert(insererTableauEnQueue(liste, tableau + 10, 3) == OK);
+   assert(insererTableauEnTete(liste, tableau + 20, 57) == OK);
+   assert(insererTableauEnTete(liste, NULL, 5) == OK);
+   size_t nombre = 0;
+   for (int i = 0; i < 5; i++) {
+      attendu[nombre++] = 0;
+   }
+   for (int i = 20; i < 77; i++) {
+      attendu[nombre++] = i;
+   }
+   for (int i = 0; i < 100; i++) {
+      attendu[nombre++] = i;
+   }
+   for (int i = 10; i < 13; i++) {
+      attendu[nombre++] = i;
+   }
+   verifierContenu(liste, attendu, nombre);
+   afficherTestOk("Test insererTableauEnQueue(), insererTableauEnTete()");
+
+   // les insertions une à une restent possibles aux deux extremités
+   Info info = -1;
+   assert(insererEnTete(liste, &info) == OK);
+   assert(insererEnQueue(liste, &info) == OK);
+   assert(INFO_TETE(liste) == -1);
+   assert(INFO_QUEUE(liste) == -1);
+   assert(supprimerEnTete(liste, NULL) == OK);
+   assert(supprimerEnQueue(liste, NULL) == OK);
+
+   // versTableau ne dépasse pas la capacité
+   Info partiel[4] = {-1, -1, -1, -1};
+   assert(versTableau(liste, partiel, 3) == 3);
+   assert(partiel[0] == 0 && partiel[2] == 0 && partiel[3] == -1);
+
+   // la liste se vide normalement, dans les deux sens
+   while (supprimerEnQueue(liste, &info) == OK) {
+      assert(info == attendu[--nombre]);
+   }
+   assert(nombre == 0);
+   assert(liste->tete == NULL);
+   afficherTestOk("Test versTableau()");
+   detruire(liste);
+
+#ifndef LISTES_DEROULEES
+   // liste non vide sans reservoir : elements alloués un à un
+   liste = initialiser();
+   assert(liste != NULL);
+   assert(insererEnQueue(liste, &tableau[0]) == OK);
+   assert(insererTableauEnQueue(liste, tableau + 1, 99) == OK);
+   assert(liste->reservoir == NULL);
+   verifierContenu(liste, tableau, 100);
+   detruire(liste);
+
+   // liste vide sans reservoir : un reservoir privé lui est attribué
+   liste = initialiser();
+   assert(liste != NULL);
+   assert(insererTableauEnTete(liste, tableau, 100) == OK);
+   assert(liste->reservoir != NULL);
+   assert(liste->tete + 99 == liste->queue);
+   verifierContenu(liste, tableau, 100);
+   detruire(liste);
+
+   // échec de l'allocation : le reservoir privé n'est pas laissé à la liste
+   liste = initialiser();
+   assert(liste != NULL);
+   assert(insererTableauEnQueue(liste, tableau, SIZE_MAX) == MEMOIRE_INSUFFISANTE);
+   assert(liste->reservoir == NULL);
+   assert(estVide(liste));
+   assert(insererEnQueue(liste, &tableau[0]) == OK);
+   detruire(liste);
+
+   // petits blocs : tableau découpé dans le bloc en cours, dans un bloc neuf ou
+   // dans un bloc sur mesure, avec un index à tenir à jour
+   liste = initialiserAvecReservoir(creerReservoir(8));
+   assert(liste != NULL);
+   libererReservoir(liste->reservoir);
+   assert(activerIndexPositionnel(liste) == OK);
+   nombre = 0;
+   for (int i = 0; i < 60; i += 10) {
+      size_t taille = (size_t) (i % 20 ? 3 : 30);
+      assert(insererTableauEnQueue(liste, tableau + i, taille) == OK);
+      for (size_t j = 0; j < taille; j++) {
+         attendu[nombre++] = tableau[(size_t) i + j];
+      }
+   }
+   verifierContenu(liste, attendu, nombre);
+   assert(supprimerEnTete(liste, NULL) == OK);
+   assert(insererTableauEnTete(liste, tableau, 40) == OK);
+   assert(elementA(liste, 39, &info) == OK);
+   assert(info == 39);
+   assert(elementA(liste, 40, &info) == OK);
+   assert(info == attendu[1]);
+   detruire(liste);
+   afficherTestOk("Test insererTableauEnQueue() avec reservoir");
+#endif
+}
+
+void testConcatenerCouper(void) {
+   Info attendu[100];
+   size_t nombre = 0;
+   Liste *l1 = initialiser();
+   Liste *l2 = initialiser();
+   assert(l1 != NULL);
+   assert(l2 != NULL);
+   for (int i = 0; i < 60; i++) {
+      assert(insererEnQueue(l1, &i) == OK);
+      attendu[nombre++] = i;
+   }
+   for (int i = 100; i < 140; i++) {
+      assert(insererEnQueue(l2, &i) == OK);
+      attendu[nombre++] = i;
+   }
+
+   // [0..59] + [100..139]
+   assert(concatener(l1, l2) == OK);
+   verifierContenu(l1, attendu, 100);
+   assert(estVide(l2) && l2->queue == NULL);
+   assert(concatener(l1, l2) == OK);
+   assert(concatener(l1, l1) == OK);
+   verifierContenu(l1, attendu, 100);
+   assert(concatener(l2, l1) == OK);
+   verifierContenu(l2, attendu, 100);
+   assert(concatener(l1, l2) == OK);
+   afficherTestOk("Test concatener()");
+
+   // couper à la fin, au-delà, au milieu puis au debut
+   assert(couperA(l1, 101) == NULL);
+   Liste *fin = couperA(l1, 100);
+   assert(fin != NULL && estVide(fin));
+   detruire(fin);
+   fin = couperA(l1, 30);
+   assert(fin != NULL);
+   verifierContenu(l1, attendu, 30);
+   verifierContenu(fin, attendu + 30, 70);
+   Liste *tout = couperA(l1, 0);
+   assert(tout != NULL);
+   assert(estVide(l1) && l1->queue == NULL);
+   verifierContenu(tout, attendu, 30);
+   detruire(l1);
+   l1 = tout;
+   afficherTestOk("Test couperA()");
+
+   // l1 = [0..29], fin = [30..59,100..139] : [35..54] va en position 10 de l1
+   Info attenduL1[100];
+   Info attenduFin[100];
+   for (int i = 0; i < 10; i++) {
+      attenduL1[i] = i;
+   }
+   for (int i = 10; i < 30; i++) {
+      attenduL1[i] = i + 25;
+      attenduL1[i + 20] = i;
+   }
+   for (int i = 0; i < 50; i++) {
+      attenduFin[i] = attendu[i < 5 ? 30 + i : 50 + i];
+   }
+   assert(transfererPlage(l1, 10, fin, 5, 20) == OK);
+   verifierContenu(l1, attenduL1, 50);
+   verifierContenu(fin, attenduFin, 50);
+
+   assert(transfererPlage(l1, 51, fin, 0, 1) == POSITION_NON_VALIDE);
+   assert(transfererPlage(l1, 0, fin, 46, 5) == POSITION_NON_VALIDE);
+   assert(transfererPlage(l1, 0, fin, 51, 0) == POSITION_NON_VALIDE);
+   assert(transfererPlage(l1, 0, l1, 0, 1) == POSITION_NON_VALIDE);
+   assert(transfererPlage(l1, 50, fin, 50, 0) == OK);
+   verifierContenu(l1, attenduL1, 50);
+
+   // en tete et en queue de l1, depuis la tete et la queue de fin
+   assert(transfererPlage(l1, 0, fin, 45, 5) == OK);
+   assert(transfererPlage(l1, 55, fin, 0, 45) == OK);
+   assert(estVide(fin) && fin->queue == NULL);
+   nombre = 0;
+   for (size_t i = 45; i < 50; i++) {
+      attendu[nombre++] = attenduFin[i];
+   }
+   for (size_t i = 0; i < 50; i++) {
+      attendu[nombre++] = attenduL1[i];
+   }
+   for (size_t i = 0; i < 45; i++) {
+      attendu[nombre++] = attenduFin[i];
+   }
+   verifierContenu(l1, attendu, 100);
+   afficherTestOk("Test transfererPlage()");
+   detruire(l1);
+   detruire(l2);
+   detruire(fin);
+
+#ifndef LISTES_DEROULEES
+   // reservoirs différents : elements recopiés ; index et empreintes à jour
+   Info tableau[60];
+   for (int i = 0; i < 60; i++) {
+      tableau[i] = i * 7;
+   }
+   l1 = initialiserAvecReservoir(NULL);
+   l2 = initialiser();
+   Liste *reference = initialiser();
+   assert(l1 != NULL && l2 != NULL && reference != NULL);
+   assert(insererTableauEnQueue(l1, tableau, 40) == OK);
+   for (size_t i = 40; i < 60; i++) {
+      assert(insererEnQueue(l2, &tableau[i]) == OK);
+   }
+   assert(insererTableauEnQueue(reference, tableau, 60) == OK);
+   assert(activerIndexPositionnel(l1) == OK);
+   assert(activerEmpreinte(l1) == OK);
+   assert(activerEmpreinte(l2) == OK);
+   assert(activerEmpreinte(reference) == OK);
+   assert(!sontEgales(l1, reference) && !sontEgales(l2, reference));
+   assert(concatener(l1, l2) == OK);
+   assert(sontEgales(l1, reference));
+   verifierContenu(l1, tableau, 60);
+   assert(estVide(l2));
+
+   // meme reservoir : elements rechaînés, index reconstruit
+   fin = couperA(l1, 20);
+   assert(fin != NULL && fin->reservoir == l1->reservoir);
+   assert(transfererPlage(l1, 10, fin, 20, 20) == OK);
+   assert(transfererPlage(fin, 20, l1, 10, 20) == OK);
+   assert(concatener(l1, fin) == OK);
+   verifierContenu(l1, tableau, 60);
+   assert(sontEgales(l1, reference));
+   detruire(fin);
+   detruire(l1);
+   detruire(l2);
+   detruire(reference);
+   afficherTestOk("Test concatener() et transfererPlage() avec reservoir");
+#endif
+}
+
+void testPersistance(void) {
+   // plusieurs tronçons d'écriture et de lecture
+   enum { NOMBRE = 40000 };
+   Liste *liste = initialiser();
+   Liste *chargee = initialiser();
+   assert(liste != NULL && chargee != NULL);
+   for (int i = 0; i < NOMBRE; i++) {
+      Info info = i * 7 - NOMBRE;
+      assert(insererEnQueue(liste, &info) == OK);
+   }
+   FILE *flux = tmpfile();
+   assert(flux != NULL);
+   assert(sauvegarder(liste, flux) == OK);
+   rewind(flux);
+   Info info = -1;
+   assert(insererEnQueue(chargee, &info) == OK);
+   assert(charger(chargee, flux) == OK);
+   assert(longueur(chargee) == NOMBRE + 1);
+   assert(supprimerEnTete(chargee, &info) == OK && info == -1);
+   assert(sontEgales(liste, chargee));
+
+   // fichier tronqué : la liste n'est pas modifiée
+   rewind(flux);
+   char octets[64 + 8 * sizeof(Info)];
+   assert(fread(octets, 1, sizeof(octets), flux) == sizeof(octets));
+   fclose(flux);
+   flux = tmpfile();
+   assert(flux != NULL);
+   fwrite(octets, 1, sizeof(octets), flux);
+   rewind(flux);
+   assert(charger(chargee, flux) == FORMAT_NON_VALIDE);
+   assert(sontEgales(liste, chargee));
+
+#ifndef LISTES_DEROULEES
+   // fichier tronqué après un premier tronçon (en-tête de 32 octets, tronçons de
+   // 16384 infos), chargé dans une liste vide sans reservoir : le reservoir
+   // privé attribué au premier tronçon ne lui reste pas
+   size_t octetsLus = 32 + (16384 + 8) * sizeof(Info);
+   char *debutFichier = (char *) malloc(octetsLus);
+   assert(debutFichier != NULL);
+   FILE *complet = tmpfile();
+   assert(complet != NULL);
+   assert(sauvegarder(liste, complet) == OK);
+   rewind(complet);
+   assert(fread(debutFichier, 1, octetsLus, complet) == octetsLus);
+   fclose(complet);
+   FILE *tronque = tmpfile();
+   assert(tronque != NULL);
+   fwrite(debutFichier, 1, octetsLus, tronque);
+   rewind(tronque);
+   Liste *vide = initialiser();
+   assert(vide != NULL);
+   assert(charger(vide, tronque) == FORMAT_NON_VALIDE);
+   assert(estVide(vide) && vide->reservoir == NULL);
+   detruire(vide);
+   fclose(tronque);
+   free(debutFichier);
+#endif
+
+   // signature non valide
+   rewind(flux);
+   octets[0] = 'X';
+   fwrite(octets, 1, sizeof(octets), flux);
+   rewind(flux);
+   assert(charger(chargee, flux) == FORMAT_NON_VALIDE);
+   fclose(flux);
+   assert(sontEgales(liste, chargee));
+   afficherTestOk("Test sauvegarder() et charger()");
+
+   flux = fopen(FICHIER_TEST_PERSISTANCE, "wb");
+   assert(flux != NULL);
+   assert(sauvegarder(liste, flux) == OK);
+   fclose(flux);
+   ListeProjetee *projetee = projeter(FICHIER_TEST_PERSISTANCE);
+   ListeProjetee *autre = projeter(FICHIER_TEST_PERSISTANCE);
+   assert(projetee != NULL && autre != NULL);
+   assert(longueurProjetee(projetee) == NOMBRE);
+   const Info *infos = infosProjetees(projetee);
+   for (int i = 0; i < NOMBRE; i++) {
+      assert(infos[i] == i * 7 - NOMBRE);
+   }
+   assert(sontEgalesProjetee(liste, projetee));
+   assert(sontEgalesProjetees(projetee, autre));
+   assert(supprimerEnQueue(chargee, NULL) == OK);
+   assert(!sontEgalesProjetee(chargee, projetee));
+   info = 0;
+   assert(insererEnQueue(chargee, &info) == OK);
+   assert(!sontEgalesProjetee(chargee, projetee));
+   detruireProjetee(autre);
+
+   // liste vide
+   vider(liste, 0);
+   flux = fopen(FICHIER_TEST_PERSISTANCE, "wb");
+   assert(flux != NULL);
+   assert(sauvegarder(liste, flux) == OK);
+   fclose(flux);
+   autre = projeter(FICHIER_TEST_PERSISTANCE);
+   assert(autre != NULL && longueurProjetee(autre) == 0);
+   assert(sontEgalesProjetee(liste, autre));
+   assert(!sontEgalesProjetees(projetee, autre));
+   detruireProjetee(autre);
+
+   // fichier tronqué
+   flux = fopen(FICHIER_TEST_PERSISTANCE, "wb");
+   assert(flux != NULL);
+   fwrite(octets, 1, 40, flux);
+   fclose(flux);
+   assert(projeter(FICHIER_TEST_PERSISTANCE) == NULL);
+   remove(FICHIER_TEST_PERSISTANCE);
+   assert(projeter(FICHIER_TEST_PERSISTANCE) == NULL);
+
+   detruireProjetee(projetee);
+   detruire(liste);
+   detruire(chargee);
+   afficherTestOk("Test projeter()");
+}
+
+void testInstrumentation(void) {
+   reinitialiserInstrumentation();
+   Liste *liste = initialiser();
+   assert(liste != NULL);
+   for (int i = 0; i < 100; i++) {
+      assert(insererEnQueue(liste, &i) == OK);
+   }
+   Info info;
+   // 10 elements parcourus depuis la tete, puis 9 depuis la queue
+   assert(elementA(liste, 10, &info) == OK && info == 10);
+   assert(elementA(liste, 90, &info) == OK && info == 90);
+   // 49 elements parcourus depuis la queue
+   vider(liste, 50);
+   detruire(liste);
+
+   Instrumentation instrumentation;
+   lireInstrumentation(&instrumentation);
+   if (!instrumentationActive()) {
+      assert(instrumentation.operations[OPERATION_INSERER_EN_QUEUE].appels == 0);
+      assert(instrumentation.elementsAlloues == 0);
+      afficherTestOk("Test instrumentation (desactivee)");
+      return;
+   }
+#ifndef LISTES_DEROULEES
+   const StatistiquesOperation *operations = instrumentation.operations;
+   assert(operations[OPERATION_INITIALISER].appels == 1);
+   assert(operations[OPERATION_INSERER_EN_QUEUE].appels == 100);
+   assert(operations[OPERATION_INSERER_EN_QUEUE].elementsParcourus == 0);
+   assert(operations[OPERATION_ELEMENT_A].appels == 2);
+   assert(operations[OPERATION_ELEMENT_A].elementsParcourus == 19);
+   assert(operations[OPERATION_ELEMENT_A].maximumParcourus == 10);
+   // detruire vide la liste (sans reservoir) : appel imbriqué de vider
+   assert(operations[OPERATION_DETRUIRE].appels == 1);
+   assert(operations[OPERATION_VIDER].appels == 2);
+   assert(operations[OPERATION_VIDER].elementsParcourus == 49);
+   size_t appels = 0;
+   for (size_t c = 0; c < CLASSES_LATENCE; c++) {
+      appels += operations[OPERATION_INSERER_EN_QUEUE].latences[c];
+   }
+   assert(appels == 100);
+   // elements alloués un à un par calloc et restitués par free
+   assert(instrumentation.elementsAlloues == 100);
+   assert(instrumentation.elementsRestitues == 100);
+   assert(instrumentation.allocationsSysteme == 100);
+   assert(instrumentation.liberationsSysteme == 100);
+
+   // reservoir : elements alloués par blocs
+   reinitialiserInstrumentation();
+   liste = initialiser();
+   assert(liste != NULL);
+   assert(insererTableauEnQueue(liste, NULL, 1000) == OK);
+   assert(supprimerEnTete(liste, NULL) == OK);
+   detruire(liste);
+   lireInstrumentation(&instrumentation);
+   assert(instrumentation.elementsAlloues == 1000);
+   assert(instrumentation.elementsRestitues == 1000);
+   assert(instrumentation.allocationsSysteme == 1);
+   assert(instrumentation.liberationsSysteme == 1);
+
+   // suppression parallèle sans reservoir : chaque element supprimé est compté
+   reinitialiserInstrumentation();
+   liste = initialiser();
+   assert(liste != NULL);
+   for (int i = 0; i < 4 * ELEMENTS_MIN_PAR_THREAD; i++) {
+      assert(insererEnQueue(liste, &i) == OK);
+   }
+   supprimerSelonCritereParallele(liste, positionEstPaire, 4);
+   lireInstrumentation(&instrumentation);
+   assert(instrumentation.elementsRestitues == 2 * ELEMENTS_MIN_PAR_THREAD);
+   detruire(liste);
+   assert(!strcmp(nomOperation(OPERATION_SONT_EGALES), "sontEgales"));
+#endif
+   afficherTestOk("Test instrumentation");
+}
+
+void testDequeConcurrente(void) {
+   DequeConcurrente *deque = initialiserDeque();
+   assert(deque != NULL);
+   Info info = 1;
+   assert(supprimerEnTeteDeque(deque, &info) == LISTE_VIDE);
+   assert(supprimerEnQueueDeque(deque, NULL) == LISTE_VIDE);
+   assert(info == 1);
+
+   // deque [0,1,2,...,9] construite par les deux extremités
+   for (int i = 5; i < 10; i++) {
+      assert(insererEnQueueDeque(deque, &i) == OK);
+   }
+   for (int i = 4; i >= 0; i--) {
+      assert(insererEnTeteDeque(deque, &i) == OK);
+   }
+   assert(longueurDeque(deque) == 10);
+   assert(supprimerEnTeteDeque(deque, &info) == OK);
+   assert(info == 0);
+   assert(supprimerEnQueueDequeBloquant(deque, &info) == OK);
+   assert(info == 9);
+   for (int i = 1; i < 9; i++) {
+      assert(supprimerEnTeteDequeBloquant(deque, &info) == OK);
+      assert(info == i);
+   }
+   assert(longueurDeque(deque) == 0);
+   assert(insererEnTeteDeque(deque, NULL) == OK);
+   assert(supprimerEnQueueDeque(deque, &info) == OK);
+   assert(info == 0);
+   afficherTestOk("Test deque concurrente, un thread");
+
+   // 4 producteurs aux deux extremités, 4 consommateurs bloquants aux deux
+   // extremités : chaque info doit être retirée exactement une fois
+   enum { PRODUCTEURS = 4, CONSOMMATEURS = 4 };
+   pthread_t threads[PRODUCTEURS + CONSOMMATEURS];
+   TravailDeque travaux[PRODUCTEURS + CONSOMMATEURS];
+   for (size_t i = 0; i < PRODUCTEURS + CONSOMMATEURS; i++) {
+      travaux[i] = (TravailDeque) {deque, i % 2 == 0, 0};
+   }
+   // les consommateurs démarrent en premier et attendent sur la deque vide
+   for (size_t i = PRODUCTEURS + CONSOMMATEURS; i-- > 0;) {
+      assert(pthread_create(&threads[i], NULL, i < PRODUCTEURS ? produire : consommer,
+                            &travaux[i]) == 0);
+   }
+   long long somme = 0;
+   for (size_t i = 0; i < PRODUCTEURS + CONSOMMATEURS; i++) {
+      assert(pthread_join(threads[i], NULL) == 0);
+      somme += travaux[i].somme;
+   }
+   assert(longueurDeque(deque) == 0);
+   assert(somme == (long long) PRODUCTEURS * INFOS_PAR_PRODUCTEUR *
+                   (INFOS_PAR_PRODUCTEUR + 1) / 2);
+   afficherTestOk("Test deque concurrente, producteurs et consommateurs");
+   detruireDeque(deque);
+}
+
+void *produire(void *argument) {
+   TravailDeque *travail = (TravailDeque *) argument;
+   for (int i = 1; i <= INFOS_PAR_PRODUCTEUR; i++) {
+      Status status = travail->enTete ? insererEnTeteDeque(travail->deque, &i)
+                                      : insererEnQueueDeque(travail->deque, &i);
+      assert(status == OK);
+   }
+   return NULL;
+}
+
+void *consommer(void *argument) {
+   TravailDeque *travail = (TravailDeque *) argument;
+   for (int i = 0; i < INFOS_PAR_PRODUCTEUR; i++) {
+      Info info;
+      Status status = travail->enTete
+                      ? supprimerEnTeteDequeBloquant(travail->deque, &info)
+                      : supprimerEnQueueDequeBloquant(travail->deque, &info);
+      assert(status == OK);
+      travail->somme += info;
+   }
+   return NULL;
+}
+
+void testDequeVol(void) {
+   DequeVol *deque = initialiserDequeVol();
+   assert(deque != NULL);
+   Info info = -1;
+   assert(supprimerEnQueueVol(deque, &info) == LISTE_VIDE);
+   assert(volerEnTete(deque, &info) == LISTE_VIDE);
+   assert(info == -1);
+
+   // assez d'infos pour agrandir plusieurs fois le tableau
+   for (int i = 0; i < 1000; i++) {
+      assert(insererEnQueueVol(deque, &i) == OK);
+   }
+   assert(longueurDequeVol(deque) == 1000);
+   // le propriétaire retire les plus récentes, les voleurs les plus anciennes
+   assert(supprimerEnQueueVol(deque, &info) == OK);
+   assert(info == 999);
+   assert(volerEnTete(deque, &info) == OK);
+   assert(info == 0);
+   for (int i = 1; i < 999; i++) {
+      assert(volerEnTete(deque, &info) == OK);
+      assert(info == i);
+   }
+   assert(supprimerEnQueueVol(deque, NULL) == LISTE_VIDE);
+   assert(insererEnQueueVol(deque, NULL) == OK);
+   assert(supprimerEnQueueVol(deque, &info) == OK);
+   assert(info == 0);
+   assert(longueurDequeVol(deque) == 0);
+   afficherTestOk("Test deque de vol, un thread");
+
+   // le propriétaire insère et retire pendant que 3 voleurs volent : chaque info
+   // doit être obtenue exactement une fois
+   enum { VOLEURS = 3 };
+   atomic_bool fini = false;
+   pthread_t threads[VOLEURS];
+   TravailVoleur travaux[VOLEURS];
+   for (size_t i = 0; i < VOLEURS; i++) {
+      travaux[i] = (TravailVoleur) {deque, &fini, 0, 0};
+      assert(pthread_create(&threads[i], NULL, voler, &travaux[i]) == 0);
+   }
+   long long somme = 0;
+   size_t nombre = 0;
+   for (int i = 1; i <= INFOS_DEQUE_VOL; i++) {
+      assert(insererEnQueueVol(deque, &i) == OK);
+      if (i % 3 == 0 && supprimerEnQueueVol(deque, &info) == OK) {
+         somme += info;
+         nombre++;
+      }
+   }
+   while (supprimerEnQueueVol(deque, &info) == OK) {
+      somme += info;
+      nombre++;
+   }
+   atomic_store(&fini, true);
+   for (size_t i = 0; i < VOLEURS; i++) {
+      assert(pthread_join(threads[i], NULL) == 0);
+      somme += travaux[i].somme;
+      nombre += travaux[i].nombre;
+   }
+   assert(nombre == INFOS_DEQUE_VOL);
+   assert(somme == (long long) INFOS_DEQUE_VOL * (INFOS_DEQUE_VOL + 1) / 2);
+   afficherTestOk("Test deque de vol, proprietaire et voleurs");
+   detruireDequeVol(deque);
+}
+
+void *voler(void *argument) {
+   TravailVoleur *travail = (TravailVoleur *) argument;
+   Info info;
+   // fini est lu avant la tentative : une deque vide après fini est définitive
+   for (bool termine = false; !termine;) {
+      termine = atomic_load(travail->fini);
+      while (volerEnTete(travail->deque, &info) == OK) {
+         travail->somme += info;
+         travail->nombre++;
+      }
+   }
+   return NULL;
+}
+
+void testListeIntrusive(void) {
+   enum { NOMBRE = 10 };
+   Enregistrement enregistrements[NOMBRE];
+   for (int i = 0; i < NOMBRE; i++) {
+      enregistrements[i] = (Enregistrement) {i, {NULL, NULL}, false};
+   }
+   ListeIntrusive liste;
+   initialiserIntrusive(&liste);
+   assert(estVideIntrusive(&liste));
+   assert(longueurIntrusive(&liste) == 0);
+   Maillon *maillon = NULL;
+   assert(supprimerEnTeteIntrusive(&liste, &maillon) == LISTE_VIDE);
+   assert(supprimerEnQueueIntrusive(&liste, &maillon) == LISTE_VIDE);
+   assert(maillon == NULL);
+
+   // [2,1,0,3,4,...,9] : les liens pointent dans le tableau, rien n'est alloué
+   for (int i = 3; i < NOMBRE; i++) {
+      insererEnQueueIntrusive(&liste, &enregistrements[i].lien);
+   }
+   for (int i = 2; i >= 0; i--) {
+      insererEnTeteIntrusive(&liste, &enregistrements[i].lien);
+   }
+   assert(longueurIntrusive(&liste) == NOMBRE);
+   assert(CONTENEUR(liste.tete, Enregistrement, lien) == &enregistrements[0]);
+   assert(CONTENEUR(liste.queue, Enregistrement, lien) == &enregistrements[NOMBRE - 1]);
+   assert(maillonAIntrusive(&liste, 2) == &enregistrements[2].lien);
+   assert(maillonAIntrusive(&liste, NOMBRE - 2) == &enregistrements[NOMBRE - 2].lien);
+   assert(maillonAIntrusive(&liste, NOMBRE) == NULL);
+
+   assert(supprimerEnTeteIntrusive(&liste, &maillon) == OK);
+   assert(CONTENEUR(maillon, Enregistrement, lien)->valeur == 0);
+   assert(maillon->suivant == NULL && maillon->precedent == NULL);
+   assert(liste.tete->precedent == NULL);
+   assert(supprimerEnQueueIntrusive(&liste, &maillon) == OK);
+   assert(CONTENEUR(maillon, Enregistrement, lien)->valeur == NOMBRE - 1);
+   assert(liste.queue->suivant == NULL);
+   assert(longueurIntrusive(&liste) == NOMBRE - 2);
+   afficherTestOk("Test liste intrusive, insertions et suppressions");
+
+   // [1,2,...,8] -> [2,4,6,8]
+   supprimerSelonCritereIntrusive(&liste, valeurEstImpaire, marquerRetire);
+   assert(longueurIntrusive(&liste) == 4);
+   int attendu = 2;
+   for (maillon = liste.tete; maillon; maillon = maillon->suivant) {
+      assert(CONTENEUR(maillon, Enregistrement, lien)->valeur == attendu);
+      attendu += 2;
+   }
+   attendu = 8;
+   for (maillon = liste.queue; maillon; maillon = maillon->precedent) {
+      assert(CONTENEUR(maillon, Enregistrement, lien)->valeur == attendu);
+      attendu -= 2;
+   }
+   for (int i = 1; i < NOMBRE - 1; i++) {
+      assert(enregistrements[i].retire == (i % 2 == 1));
+   }
+
+   // une liste de mêmes valeurs, chaînée par d'autres enregistrements
+   Enregistrement copies[4];
+   ListeIntrusive autre;
+   initialiserIntrusive(&autre);
+   for (int i = 0; i < 4; i++) {
+      copies[i] = (Enregistrement) {2 * (i + 1), {NULL, NULL}, false};
+      insererEnQueueIntrusive(&autre, &copies[i].lien);
+   }
+   assert(sontEgalesIntrusives(&liste, &autre, memesValeurs));
+   copies[3].valeur = 0;
+   assert(!sontEgalesIntrusives(&liste, &autre, memesValeurs));
+
+   // vider depuis les deux moitiés de la liste
+   viderIntrusive(&liste, 4, marquerRetire);
+   assert(longueurIntrusive(&liste) == 4);
+   viderIntrusive(&liste, 3, marquerRetire);
+   assert(enregistrements[8].retire);
+   assert(longueurIntrusive(&liste) == 3);
+   assert(liste.queue == &enregistrements[6].lien && liste.queue->suivant == NULL);
+   viderIntrusive(&liste, 1, NULL);
+   assert(longueurIntrusive(&liste) == 1);
+   assert(liste.tete == liste.queue && liste.tete == &enregistrements[2].lien);
+   assert(enregistrements[4].lien.suivant == NULL);
+   viderIntrusive(&liste, 0, NULL);
+   assert(estVideIntrusive(&liste) && liste.queue == NULL);
+   assert(sontEgalesIntrusives(&liste, &liste, memesValeurs));
+   afficherTestOk("Test liste intrusive, critere, egalite et vider");
+}
+
+bool valeurEstImpaire(size_t pos, const Maillon *maillon) {
+   (void) pos; //eviter le warning de parametre non utilise
+   return CONTENEUR(maillon, const Enregistrement, lien)->valeur % 2;
+}
+
+void marquerRetire(Maillon *maillon) {
+   CONTENEUR(maillon, Enregistrement, lien)->retire = true;
+}
+
+bool memesValeurs(const Maillon *maillon1, const Maillon *maillon2) {
+   return CONTENEUR(maillon1, const Enregistrement, lien)->valeur ==
+          CONTENEUR(maillon2, const Enregistrement, lien)->valeur;
+}
+
+void testListesGeneriques(void) {
+   ListeReels *reels = initialiserListeReels();
+   assert(reels != NULL);
+   assert(estVideListeReels(reels));
+   double reel = 1.5;
+   assert(supprimerEnTeteListeReels(reels, &reel) == LISTE_VIDE);
+   assert(supprimerEnQueueListeReels(reels, &reel) == LISTE_VIDE);
+   assert(elementAListeReels(reels, 0, &reel) == POSITION_NON_VALIDE);
+   // -2.5 -1.5 -0.5 0.5 1.5 2.5
+   for (int i = 0; i < 3; i++) {
+      reel = 0.5 + i;
+      assert(insererEnQueueListeReels(reels, &reel) == OK);
+      reel = -reel;
+      assert(insererEnTeteListeReels(reels, &reel) == OK);
+   }
+   assert(longueurListeReels(reels) == 6);
+   assert(elementAListeReels(reels, 6, &reel) == POSITION_NON_VALIDE);
+   assert(premierListeReels(reels)->info == -2.5 && dernierListeReels(reels)->info == 2.5);
+   for (size_t i = 0; i < 6; i++) {
+      assert(elementAListeReels(reels, i, &reel) == OK && reel == -2.5 + (double) i);
+   }
+   ListeReels *copie = initialiserListeReels();
+   assert(copie != NULL);
+   for (const ElementListeReels *element = dernierListeReels(reels); element;
+        element = precedentListeReels(element)) {
+      assert(insererEnTeteListeReels(copie, &element->info) == OK);
+   }
+   assert(sontEgalesListeReels(reels, copie));
+   supprimerSelonCritereListeReels(reels, reelEstNegatif);
+   assert(!sontEgalesListeReels(reels, copie));
+   double tableau[6];
+   assert(versTableauListeReels(reels, tableau, 6) == 3);
+   assert(tableau[0] == 0.5 && tableau[1] == 1.5 && tableau[2] == 2.5);
+   assert(precedentListeReels(premierListeReels(reels)) == NULL);
+   assert(suivantListeReels(dernierListeReels(reels)) == NULL);
+   viderListeReels(copie, 3);
+   assert(sontEgalesListeReels(reels, copie) == false);
+   assert(supprimerEnQueueListeReels(copie, &reel) == OK && reel == -0.5);
+   assert(supprimerEnTeteListeReels(copie, &reel) == OK && reel == -2.5);
+   assert(longueurListeReels(copie) == 1);
+   assert(premierListeReels(copie) == dernierListeReels(copie));
+   viderListeReels(copie, 0);
+   assert(estVideListeReels(copie) && dernierListeReels(copie) == NULL);
+   detruireListeReels(copie);
+   detruireListeReels(reels);
+
+   // structures stockées directement dans les elements
+   ListeNavires *navires = initialiserListeNavires();
+   assert(navires != NULL);
+   Navire navire = {"Santa Maria", 12.5};
+   assert(insererEnQueueListeNavires(navires, &navire) == OK);
+   assert(insererEnTeteListeNavires(navires, NULL) == OK);
+   strcpy(navire.nom, "Pinta");
+   assert(insererEnQueueListeNavires(navires, &navire) == OK);
+   const ElementListeNavires *premier = premierListeNavires(navires);
+   assert(premier->info.nom[0] == '\0' && premier->info.taxe == 0.0);
+   assert(elementAListeNavires(navires, 1, &navire) == OK);
+   assert(strcmp(navire.nom, "Santa Maria") == 0 && navire.taxe == 12.5);
+   ListeNavires *autres = initialiserListeNavires();
+   assert(autres != NULL);
+   for (const ElementListeNavires *element = premier; element;
+        element = suivantListeNavires(element)) {
+      assert(insererEnQueueListeNavires(autres, &element->info) == OK);
+   }
+   assert(sontEgalesListeNavires(navires, autres));
+   dernierListeNavires(autres)->info.taxe = 1.0;
+   assert(!sontEgalesListeNavires(navires, autres));
+   detruireListeNavires(autres);
+   detruireListeNavires(navires);
+   afficherTestOk("Test listes generiques");
+}
+
+void testListeVariable(void) {
+   ListeVariable *liste = initialiserVariable();
+   assert(liste != NULL);
+   assert(estVideVariable(liste));
+   char tampon[32];
+   size_t taille;
+   assert(supprimerEnTeteVariable(liste, tampon, sizeof(tampon), &taille) ==
+          LISTE_VIDE);
+   assert(supprimerEnQueueVariable(liste, NULL, 0, NULL) == LISTE_VIDE);
+
+   const char *noms[] = {"Nina", "Pinta", "Santa Maria", "", "Pourquoi-Pas ?"};
+   enum { NOMBRE = sizeof(noms) / sizeof(noms[0]) };
+   // Pinta Nina | Santa Maria "" Pourquoi-Pas ?
+   assert(insererEnTeteVariable(liste, noms[0], strlen(noms[0]) + 1) == OK);
+   assert(insererEnTeteVariable(liste, noms[1], strlen(noms[1]) + 1) == OK);
+   for (size_t i = 2; i < NOMBRE; i++) {
+      assert(insererEnQueueVariable(liste, noms[i], strlen(noms[i]) + 1) == OK);
+   }
+   assert(insererEnQueueVariable(liste, NULL, 0) == OK);
+   assert(longueurVariable(liste) == NOMBRE + 1);
+   // les donnees suivent directement les liens de l'element
+   ElementVariable *premier = premierVariable(liste);
+   assert((unsigned char *) premier->donnees > (unsigned char *) premier);
+   assert((size_t) ((unsigned char *) premier->donnees -
+                    (unsigned char *) premier) == sizeof(ElementVariable));
+   assert((uintptr_t) premier->donnees % _Alignof(max_align_t) == 0);
+   assert(precedentVariable(premier) == NULL);
+   assert(suivantVariable(dernierVariable(liste)) == NULL);
+
+   ElementVariable *element;
+   assert(elementAVariable(liste, NOMBRE + 1, &element) == POSITION_NON_VALIDE);
+   assert(elementAVariable(liste, 2, &element) == OK);
+   assert(element->taille == strlen(noms[2]) + 1);
+   assert(strcmp((const char *) element->donnees, noms[2]) == 0);
+   assert(elementAVariable(liste, NOMBRE, &element) == OK && element->taille == 0);
+   // modification en place
+   element = premier;
+   element->donnees[0] = 'Q';
+   assert(strcmp((const char *) premierVariable(liste)->donnees, "Qinta") == 0);
+   element->donnees[0] = 'P';
+
+   ListeVariable *copie = initialiserVariable();
+   assert(copie != NULL);
+   for (const ElementVariable *e = premier; e; e = suivantVariable(e)) {
+      assert(insererEnQueueVariable(copie, e->donnees, e->taille) == OK);
+   }
+   assert(sontEgalesVariables(liste, copie));
+   // meme contenu, tailles différentes
+   assert(supprimerEnQueueVariable(copie, NULL, 0, &taille) == OK && taille == 0);
+   assert(insererEnQueueVariable(copie, "", 1) == OK);
+   assert(!sontEgalesVariables(liste, copie));
+   viderVariable(copie, NOMBRE);
+   assert(longueurVariable(copie) == NOMBRE);
+   assert(supprimerEnQueueVariable(liste, NULL, 0, NULL) == OK);
+   assert(sontEgalesVariables(liste, copie));
+
+   supprimerSelonCritereVariable(liste, commenceParP);
+   assert(longueurVariable(liste) == NOMBRE - 2);
+   // copie tronquée à la capacité, taille complète renvoyée
+   assert(supprimerEnTeteVariable(liste, tampon, 3, &taille) == OK);
+   assert(taille == strlen(noms[0]) + 1 && memcmp(tampon, "Nin", 3) == 0);
+   assert(supprimerEnTeteVariable(liste, tampon, sizeof(tampon), &taille) == OK);
+   assert(strcmp(tampon, noms[2]) == 0);
+   assert(supprimerEnQueueVariable(liste, tampon, sizeof(tampon), &taille) == OK);
+   assert(taille == 1 && tampon[0] == '\0');
+   assert(estVideVariable(liste) && dernierVariable(liste) == NULL);
+
+   viderVariable(copie, 0);
+   assert(estVideVariable(copie) && longueurVariable(copie) == 0);
+   assert(sontEgalesVariables(liste, copie));
+   detruireVariable(copie);
+   detruireVariable(liste);
+   afficherTestOk("Test liste variable");
+}
+
+bool commenceParP(size_t pos, const void *donnees, size_t taille) {
+   (void) pos; //eviter le warning de parametre non utilise
+   return taille && *(const char *) donnees == 'P';
+}
+
+bool naviresEgaux(const Navire *navire1, const Navire *navire2) {
+   return strcmp(navire1->nom, navire2->nom) == 0 && navire1->taxe == navire2->taxe;
+}
+
+bool reelEstNegatif(size_t pos, const double *reel) {
+   (void) pos; //eviter le warning de parametre non utilise
+   return *reel < 0;
+}
+
+#ifndef LISTES_DEROULEES
+void testReservoir(void) {
+   ReservoirElements *reservoir = creerReservoir(4);
+   assert(reservoir != NULL);
+   Liste *l1 = initialiserAvecReservoir(reservoir);
+   Liste *l2 = initialiserAvecReservoir(reservoir);
+   assert(l1 != NULL);
+   assert(l2 != NULL);
+   assert(l1->reservoir == reservoir);
+   // les listes gardent le reservoir en vie
+   libererReservoir(reservoir);
+
+   // plus d'elements qu'un bloc pour forcer l'allocation de plusieurs blocs
+   for (int i = 0; i < 10; i++) {
+      assert(insererEnQueue(l1, &i) == OK);
+      assert(insererEnTete(l2, &i) == OK);
+   }
+   assert(longueur(l1) == 10);
+   assert(l1->tete->info == 0);
+   assert(l2->tete->info == 9);
+   afficherTestOk("Test reservoir, insertion");
+
+   // un element restitué est recyclé par la prochaine insertion
+   Info info;
+   Element *queue = l1->queue;
+   assert(supprimerEnQueue(l1, &info) == OK);
+   assert(info == 9);
+   assert(insererEnTete(l2, NULL) == OK);
+   assert(l2->tete == queue);
+   assert(l2->tete->info == 0);
+   assert(l2->tete->precedent == NULL);
+   afficherTestOk("Test reservoir, recyclage");
+
+   supprimerSelonCritere(l1, positionEstPaire);
+   assert(longueur(l1) == 4);
+   vider(l2, 5);
+   assert(longueur(l2) == 5);
+   assert(l2->queue->suivant == NULL);
+   afficherTestOk("Test reservoir, suppressions");
+
+   // l2 rend ses elements au reservoir, l1 restitue ensuite tous les blocs
+   detruire(l2);
+   for (int i = 0; i < 20; i++) {
+      assert(insererEnQueue(l1, &i) == OK);
+   }
+   assert(longueur(l1) == 24);
+   detruire(l1);
+
+   Liste *privee = initialiserAvecReservoir(NULL);
+   assert(privee != NULL);
+   assert(privee->reservoir != NULL);
+   assert(insererEnQueue(privee, &info) == OK);
+   detruire(privee);
+   afficherTestOk("Test reservoir, destruction");
+}
+
+void testIndexPositionnel(void) {
+   Liste *liste = initialiser();
+   assert(liste != NULL);
+   for (int i = 0; i < 10; i++) {
+      assert(insererEnQueue(liste, &i) == OK);
+   }
+   assert(activerIndexPositionnel(liste) == OK);
+   assert(activerIndexPositionnel(liste) == OK);
+
+   // insertions des deux cotés, au-dela de la capacité initiale de l'index
+   for (int i = 10; i < 40; i++) {
+      Info aux = -i;
+      assert(insererEnQueue(liste, &i) == OK);
+      assert(insererEnTete(liste, &aux) == OK);
+   }
+   // liste : [-39, ..., -10, 0, ..., 39]
+   Info info;
+   assert(elementA(liste, 0, &info) == OK);
+   assert(info == -39);
+   assert(elementA(liste, 30, &info) == OK);
+   assert(info == 0);
+   assert(elementA(liste, 69, &info) == OK);
+   assert(info == 39);
+   assert(elementA(liste, 70, &info) == POSITION_NON_VALIDE);
+   afficherTestOk("Test index positionnel, insertion");
+
+   assert(supprimerEnTete(liste, NULL) == OK);
+   assert(supprimerEnQueue(liste, NULL) == OK);
+   assert(elementA(liste, 0, &info) == OK);
+   assert(info == -38);
+   assert(elementA(liste, 67, &info) == OK);
+   assert(info == 38);
+   assert(elementA(liste, 68, &info) == POSITION_NON_VALIDE);
+   afficherTestOk("Test index positionnel, suppression en tete et en queue");
+
+   // il reste les positions impaires : [-37, -35, ..., -11, 0, 2, ..., 38]
+   supprimerSelonCritere(liste, positionEstPaire);
+   assert(elementA(liste, 0, &info) == OK);
+   assert(info == -37);
+   assert(elementA(liste, 14, &info) == OK);
+   assert(info == 0);
+   assert(elementA(liste, 33, &info) == OK);
+   assert(info == 38);
+   assert(elementA(liste, 34, &info) == POSITION_NON_VALIDE);
+   afficherTestOk("Test index positionnel, supprimer selon critere");
+
+   vider(liste, 15);
+   assert(longueur(liste) == 15);
+   assert(elementA(liste, 14, &info) == OK);
+   assert(info == 0);
+   assert(elementA(liste, 15, &info) == POSITION_NON_VALIDE);
+   assert(INFO_QUEUE(liste) == 0);
+   afficherTestOk("Test index positionnel, vider");
+
+   desactiverIndexPositionnel(liste);
+   assert(liste->index == NULL);
+   assert(elementA(liste, 14, &info) == OK);
+   assert(info == 0);
+   detruire(liste);
+}
+
+void testSupprimerSelonCritereParLot(void) {
+   // plusieurs lots, le dernier incomplet
+   const int LONGUEUR = 3 * TAILLE_LOT_CRITERE + 10;
+   Liste *liste = initialiser();
+   Liste *attendue = initialiser();
+   assert(liste != NULL);
+   assert(attendue != NULL);
+   for (int i = 0; i < LONGUEUR; i++) {
+      Info info = i % 10;
+      assert(insererEnQueue(liste, &info) == OK);
+      assert(insererEnQueue(attendue, &info) == OK);
+   }
+   assert(activerIndexPositionnel(liste) == OK);
+
+   supprimerSelonCritereParLot(liste, estEntre3et7ParLot);
+   supprimerSelonCritere(attendue, estEntre3et7);
+   assert(sontEgales(liste, attendue));
+   assert(INFO_TETE(liste) == 3);
+   assert(INFO_QUEUE(liste) == 7);
+   assert(liste->tete->precedent == NULL);
+   assert(liste->queue->suivant == NULL);
+   Info info;
+   assert(elementA(liste, 5, &info) == OK);
+   assert(info == 3);
+   afficherTestOk("Test supprimer selon critere par lot (info)");
+
+   supprimerSelonCritereParLot(liste, positionEstPaireParLot);
+   supprimerSelonCritere(attendue, positionEstPaire);
+   assert(sontEgales(liste, attendue));
+   // [4,6,3,5,7,4,...]
+   assert(elementA(liste, 2, &info) == OK);
+   assert(info == 3);
+   afficherTestOk("Test supprimer selon critere par lot (position)");
+
+   vider(liste, 0);
+   supprimerSelonCritereParLot(liste, positionEstPaireParLot);
+   assert(estVide(liste));
+   assert(insererEnQueue(liste, &info) == OK);
+   supprimerSelonCritereParLot(liste, positionEstPaireParLot);
+   assert(estVide(liste));
+   assert(liste->queue == NULL);
+   afficherTestOk("Test supprimer selon critere par lot (tout)");
+
+   detruire(liste);
+   detruire(attendue);
+}
+
+void testSupprimerSelonCritereParallele(void) {
+   // assez d'elements pour que 4 threads soient effectivement utilisés
+   const int LONGUEUR = 4 * ELEMENTS_MIN_PAR_THREAD + 123;
+   Liste *listes[3] = {initialiser(), initialiserAvecReservoir(NULL),
+                       initialiser()};
+   Liste *attendue = initialiser();
+   assert(attendue != NULL);
+   for (int i = 0; i < LONGUEUR; i++) {
+      Info info = i % 7;
+      assert(insererEnQueue(attendue, &info) == OK);
+      for (size_t j = 0; j < 3; j++) {
+         assert(listes[j] != NULL);
+         assert(insererEnQueue(listes[j], &info) == OK);
+      }
+   }
+   assert(activerIndexPositionnel(listes[2]) == OK);
+
+   supprimerSelonCritere(attendue, positionPlusInfoMultipleDe3);
+   for (size_t j = 0; j < 3; j++) {
+      supprimerSelonCritereParallele(listes[j], positionPlusInfoMultipleDe3, 4);
+      assert(sontEgales(listes[j], attendue));
+      assert(listes[j]->tete->precedent == NULL);
+      assert(listes[j]->queue->suivant == NULL);
+   }
+   Info info, infoAttendue;
+   assert(elementA(listes[2], 30000, &info) == OK);
+   assert(elementA(attendue, 30000, &infoAttendue) == OK);
+   assert(info == infoAttendue);
+   afficherTestOk("Test supprimer selon critere en parallele");
+
+   for (size_t j = 0; j < 3; j++) {
+      supprimerSelonCritereParallele(listes[j], suppressionComplete, 4);
+      assert(estVide(listes[j]));
+      assert(listes[j]->queue == NULL);
+      assert(longueur(listes[j]) == 0);
+      detruire(listes[j]);
+   }
+   afficherTestOk("Test supprimer selon critere en parallele (tout)");
+   detruire(attendue);
+}
+
+void testInsererTableauEnQueueParallele(void) {
+   // assez d'elements pour que 4 threads soient effectivement utilisés
+   const size_t LONGUEUR = 4 * ELEMENTS_MIN_PAR_THREAD + 123;
+   Info *tableau = (Info *) malloc(LONGUEUR * sizeof(Info));
+   assert(tableau != NULL);
+   for (size_t i = 0; i < LONGUEUR; i++) {
+      tableau[i] = (Info) (i * 7 % 1000);
+   }
+   // vide, non vide sans reservoir, reservoir partagé, index et empreinte
+   ReservoirElements *reservoir = creerReservoir(0);
+   assert(reservoir != NULL);
+   Liste *listes[4] = {initialiser(), initialiser(),
+                       initialiserAvecReservoir(reservoir), initialiser()};
+   libererReservoir(reservoir);
+   Liste *attendue = initialiser();
+   assert(attendue != NULL);
+   Info info = -1;
+   assert(insererEnQueue(attendue, &info) == OK);
+   for (size_t j = 0; j < 4; j++) {
+      assert(listes[j] != NULL);
+      if (j) {
+         assert(insererEnQueue(listes[j], &info) == OK);
+      }
+   }
+   assert(activerIndexPositionnel(listes[3]) == OK);
+   assert(activerEmpreinte(listes[3]) == OK);
+   assert(activerEmpreinte(attendue) == OK);
+   for (size_t i = 0; i < LONGUEUR; i++) {
+      assert(insererEnQueue(attendue, &tableau[i]) == OK);
+   }
+
+   assert(insererTableauEnQueueParallele(listes[0], tableau, LONGUEUR, 4) == OK);
+   verifierContenu(listes[0], tableau, LONGUEUR);
+   assert(listes[0]->tete->precedent == NULL && listes[0]->queue->suivant == NULL);
+   for (size_t j = 1; j < 4; j++) {
+      assert(insererTableauEnQueueParallele(listes[j], tableau, LONGUEUR, 4) == OK);
+      assert(longueur(listes[j]) == LONGUEUR + 1);
+      assert(sontEgales(listes[j], attendue));
+      assert(listes[j]->queue->suivant == NULL);
+   }
+   // les elements sont pris dans le reservoir partagé
+   assert(listes[2]->reservoir == reservoir);
+   Info infoAttendue;
+   for (size_t position = 0; position <= LONGUEUR; position += 997) {
+      assert(elementA(listes[3], position, &info) == OK);
+      assert(elementA(attendue, position, &infoAttendue) == OK);
+      assert(info == infoAttendue);
+   }
+   // à la suite d'une insertion parallèle, puis infos à 0 (tableau NULL)
+   assert(insererTableauEnQueueParallele(listes[3], tableau, LONGUEUR, 4) == OK);
+   assert(insererTableauEnQueueParallele(listes[3], NULL, LONGUEUR, 8) == OK);
+   assert(longueur(listes[3]) == 3 * LONGUEUR + 1);
+   assert(elementA(listes[3], 2 * LONGUEUR, &info) == OK && info == tableau[LONGUEUR - 1]);
+   assert(elementA(listes[3], 2 * LONGUEUR + 1, &info) == OK && info == 0);
+   assert(elementA(listes[3], 3 * LONGUEUR, &info) == OK && info == 0);
+   // peu d'elements : insertion séquentielle
+   assert(insererTableauEnQueueParallele(listes[1], tableau, 10, 4) == OK);
+   assert(insererTableauEnQueueParallele(listes[1], tableau, 0, 4) == OK);
+   assert(longueur(listes[1]) == LONGUEUR + 11);
+   assert(INFO_QUEUE(listes[1]) == tableau[9]);
+
+   for (size_t j = 0; j < 4; j++) {
+      detruire(listes[j]);
+   }
+   detruire(attendue);
+   free(tableau);
+   afficherTestOk("Test insererTableauEnQueueParallele()");
+}
+
+void testRepertoireSegments(void) {
+   // assez d'elements pour que 4 threads soient effectivement utilisés
+   const int LONGUEUR = 4 * ELEMENTS_MIN_PAR_THREAD + 123;
+   Liste *liste = initialiser();
+   Liste *attendue = initialiser();
+   Liste *autre = initialiser();
+   assert(liste != NULL && attendue != NULL && autre != NULL);
+   for (int i = 0; i < LONGUEUR; i++) {
+      Info info = i % 11;
+      assert(insererEnQueue(liste, &info) == OK);
+      assert(insererEnQueue(attendue, &info) == OK);
+      assert(insererEnQueue(autre, &info) == OK);
+   }
+   // un petit pas pour que les debuts de segments tombent entre deux entrées
+   assert(activerRepertoireSegments(liste, 100) == OK);
+   verifierTraitementsParalleles(liste, attendue);
+
+   // insertions et suppressions en queue : répertoire tenu à jour
+   for (int i = 0; i < 250; i++) {
+      Info info = i;
+      assert(insererEnQueue(liste, &info) == OK);
+      assert(insererEnQueue(attendue, &info) == OK);
+   }
+   verifierTraitementsParalleles(liste, attendue);
+   for (int i = 0; i < 130; i++) {
+      assert(supprimerEnQueue(liste, NULL) == OK);
+      assert(supprimerEnQueue(attendue, NULL) == OK);
+   }
+   verifierTraitementsParalleles(liste, attendue);
+   Info tableau[] = {5, 6, 7};
+   assert(insererTableauEnQueue(liste, tableau, 3) == OK);
+   assert(insererTableauEnQueue(attendue, tableau, 3) == OK);
+   vider(liste, (size_t) LONGUEUR - 1001);
+   vider(attendue, (size_t) LONGUEUR - 1001);
+   verifierTraitementsParalleles(liste, attendue);
+
+   // modifications en tete et au milieu : répertoire reconstruit
+   assert(insererEnTete(liste, &tableau[0]) == OK);
+   assert(insererEnTete(attendue, &tableau[0]) == OK);
+   verifierTraitementsParalleles(liste, attendue);
+   supprimerSelonCritere(liste, positionPlusInfoMultipleDe3);
+   supprimerSelonCritere(attendue, positionPlusInfoMultipleDe3);
+   verifierTraitementsParalleles(liste, attendue);
+   Curseur curseur = curseurEnTete(liste);
+   Curseur curseurAttendue = curseurEnTete(attendue);
+   for (int i = 0; i < 12345; i++) {
+      avancerCurseur(&curseur);
+      avancerCurseur(&curseurAttendue);
+   }
+   assert(insererAvantCurseur(&curseur, &tableau[1]) == OK);
+   assert(insererAvantCurseur(&curseurAttendue, &tableau[1]) == OK);
+   assert(compacter(liste) == OK);
+   verifierTraitementsParalleles(liste, attendue);
+
+   // concatener : liste reçoit les elements en queue, autre est vidée
+   assert(activerRepertoireSegments(autre, 0) == OK);
+   verifierTraitementsParalleles(autre, autre);
+   Liste *copie = initialiser();
+   assert(copie != NULL);
+   assert(insererTableauEnQueue(copie, tableau, 3) == OK);
+   assert(concatener(copie, autre) == OK);
+   assert(concatener(liste, copie) == OK);
+   assert(estVide(autre) && estVide(copie));
+   assert(insererTableauEnQueue(attendue, tableau, 3) == OK);
+   for (int i = 0; i < LONGUEUR; i++) {
+      Info info = i % 11;
+      assert(insererEnQueue(attendue, &info) == OK);
+   }
+   verifierTraitementsParalleles(liste, attendue);
+   assert(compterSelonCritereParallele(autre, suppressionComplete, 4) == 0);
+
+   // différences de longueur, puis d'une seule info, près de la queue
+   Info info;
+   assert(supprimerEnQueue(liste, &info) == OK);
+   assert(!sontEgalesParallele(liste, attendue, 4));
+   info++;
+   assert(insererEnQueue(liste, &info) == OK);
+   assert(!sontEgalesParallele(liste, attendue, 4));
+   assert(!sontEgalesParallele(attendue, liste, 8));
+
+   // changement de pas, puis sans répertoire
+   assert(activerRepertoireSegments(attendue, 7) == OK);
+   assert(activerRepertoireSegments(attendue, 5000) == OK);
+   verifierTraitementsParalleles(attendue, attendue);
+   desactiverRepertoireSegments(attendue);
+   verifierTraitementsParalleles(attendue, attendue);
+
+   detruire(liste);
+   detruire(attendue);
+   detruire(autre);
+   detruire(copie);
+   afficherTestOk("Test repertoire de segments et traitements paralleles");
+}
+
+void verifierTraitementsParalleles(const Liste *liste, const Liste *attendue) {
+   size_t taille = longueur(attendue);
+   Info *infos = (Info *) malloc(taille * sizeof(Info));
+   assert(infos != NULL);
+   assert(versTableau(attendue, infos, taille) == taille);
+   size_t compte = 0;
+   uint64_t somme = 0;
+   for (size_t i = 0; i < taille; i++) {
+      compte += positionPlusInfoMultipleDe3(i, &infos[i]);
+      accumulerSommePonderee(&somme, i, &infos[i]);
+   }
+   free(infos);
+
+   for (size_t threads = 1; threads <= 8; threads *= 2) {
+      assert(compterSelonCritereParallele(liste, positionPlusInfoMultipleDe3,
+                                          threads) == compte);
+      uint64_t resultat = 0;
+      const uint64_t neutre = 0;
+      replierParallele(liste, &resultat, &neutre, sizeof(uint64_t),
+                       accumulerSommePonderee, combinerSommes, threads);
+      assert(resultat == somme);
+      assert(sontEgalesParallele(liste, attendue, threads));
+   }
+}
+
+void testEmpreinte(void) {
+   Liste *l1 = initialiser();
+   Liste *l2 = initialiser();
+   assert(l1 != NULL);
+   assert(l2 != NULL);
+   assert(activerEmpreinte(l1) == OK);
+   assert(activerEmpreinte(l1) == OK);
+   assert(l1->empreinte != NULL);
+   // la comparaison de listes vides rend les empreintes valides : elles sont
+   // ensuite tenues à jour à chaque modification
+   assert(sontEgales(l1, l2));
+   assert(activerEmpreinte(l2) == OK);
+   assert(sontEgales(l1, l2));
+
+   Info tableau[20];
+   for (int i = 0; i < 20; i++) {
+      tableau[i] = i * 1000 - 7;
+   }
+   for (int i = 0; i < 50; i++) {
+      assert(insererEnQueue(l1, &i) == OK);
+   }
+   for (int i = -1; i > -10; i--) {
+      assert(insererEnTete(l1, &i) == OK);
+   }
+   assert(insererTableauEnTete(l1, tableau, 20) == OK);
+   assert(insererTableauEnQueue(l1, tableau, 20) == OK);
+   assert(supprimerEnTete(l1, NULL) == OK);
+   assert(supprimerEnTete(l1, NULL) == OK);
+   assert(supprimerEnQueue(l1, NULL) == OK);
+
+   // l2 reçoit le même contenu par un autre chemin (insertions en tete, depuis
+   // la queue de l1)
+   Info info;
+   for (size_t i = longueur(l1); i-- > 0;) {
+      assert(elementA(l1, i, &info) == OK);
+      assert(insererEnTete(l2, &info) == OK);
+   }
+   assert(sontEgales(l1, l2));
+
+   // meme longueur, une seule info différente
+   assert(supprimerEnQueue(l2, &info) == OK);
+   info++;
+   assert(insererEnQueue(l2, &info) == OK);
+   assert(!sontEgales(l1, l2));
+   assert(!sontEgales(l2, l1));
+   afficherTestOk("Test empreinte, insertions et suppressions");
+
+   // l'empreinte est recalculée après les modifications au milieu de la liste
+   assert(supprimerEnQueue(l2, &info) == OK);
+   info--;
+   assert(insererEnQueue(l2, &info) == OK);
+   supprimerSelonCritere(l1, positionEstPaire);
+   assert(!sontEgales(l1, l2));
+   supprimerSelonCritere(l2, positionEstPaire);
+   assert(sontEgales(l1, l2));
+   vider(l1, 10);
+   assert(!sontEgales(l1, l2));
+   vider(l2, 10);
+   assert(sontEgales(l1, l2));
+   assert(supprimerEnTete(l1, NULL) == OK);
+   assert(supprimerEnTete(l2, NULL) == OK);
+   assert(sontEgales(l1, l2));
+   afficherTestOk("Test empreinte, supprimerSelonCritere() et vider()");
+
+   desactiverEmpreinte(l1);
+   assert(l1->empreinte == NULL);
+   assert(sontEgales(l1, l2));
+   detruire(l1);
+   detruire(l2);
+}
+
+void testCurseur(void) {
+   Liste *vide = initialiser();
+   assert(vide != NULL);
+   Curseur curseur = curseurEnTete(vide);
+   Info info = -1;
+   assert(!estDansListe(&curseur));
+   assert(avancerCurseur(&curseur) == POSITION_NON_VALIDE);
+   assert(reculerCurseur(&curseur) == POSITION_NON_VALIDE);
+   assert(infoCurseur(&curseur, &info) == POSITION_NON_VALIDE);
+   assert(insererAvantCurseur(&curseur, &info) == POSITION_NON_VALIDE);
+   assert(insererApresCurseur(&curseur, &info) == POSITION_NON_VALIDE);
+   assert(supprimerCurseur(&curseur, &info) == POSITION_NON_VALIDE);
+   assert(info == -1);
+   curseur = curseurEnQueue(vide);
+   assert(!estDansListe(&curseur));
+   assert(estVide(vide));
+   detruire(vide);
+
+   // une passe d'edition : les multiples de 3 sont supprimés, chaque info paire
+   // est suivie de info + 100, et la liste est encadrée par -1 et 99
+   Info tableau[20];
+   for (int i = 0; i < 20; i++) {
+      tableau[i] = i;
+   }
+   const Info attendu[] = {-1, 1, 2, 102, 4, 104, 5, 7, 8, 108, 10, 110, 11, 13,
+                           14, 114, 16, 116, 17, 19, 99};
+   const size_t nombre = sizeof(attendu) / sizeof(Info);
+   Liste *reference = initialiser();
+   assert(reference != NULL);
+   assert(insererTableauEnQueue(reference, attendu, nombre) == OK);
+   assert(activerEmpreinte(reference) == OK);
+
+   for (int avecIndex = 0; avecIndex < 2; avecIndex++) {
+      Liste *liste = initialiser();
+      assert(liste != NULL);
+      assert(insererTableauEnQueue(liste, tableau, 20) == OK);
+      assert(activerEmpreinte(liste) == OK);
+      // empreintes valides : elles doivent être invalidées par les modifications
+      assert(!sontEgales(liste, reference));
+      if (avecIndex) {
+         assert(activerIndexPositionnel(liste) == OK);
+      }
+
+      curseur = curseurEnTete(liste);
+      assert(insererAvantCurseur(&curseur, &attendu[0]) == OK);
+      assert(curseur.position == 1);
+      while (estDansListe(&curseur)) {
+         assert(infoCurseur(&curseur, &info) == OK);
+         if (info % 3 == 0) {
+            Info supprimee;
+            assert(supprimerCurseur(&curseur, &supprimee) == OK);
+            assert(supprimee == info);
+            continue;
+         }
+         if (info % 2 == 0) {
+            Info nouvelle = info + 100;
+            assert(insererApresCurseur(&curseur, &nouvelle) == OK);
+            assert(avancerCurseur(&curseur) == OK);
+         }
+         avancerCurseur(&curseur);
+      }
+      curseur = curseurEnQueue(liste);
+      assert(curseur.position == longueur(liste) - 1);
+      assert(insererApresCurseur(&curseur, &attendu[nombre - 1]) == OK);
+      verifierContenu(liste, attendu, nombre);
+      assert(sontEgales(liste, reference));
+
+      // retour en arriere depuis la queue, puis suppression des extremités
+      curseur = curseurEnQueue(liste);
+      for (size_t i = nombre - 1; i > 0; i--) {
+         assert(curseur.position == i);
+         assert(infoCurseur(&curseur, &info) == OK && info == attendu[i]);
+         assert(reculerCurseur(&curseur) == OK);
+      }
+      assert(reculerCurseur(&curseur) == POSITION_NON_VALIDE);
+      curseur = curseurEnQueue(liste);
+      assert(supprimerCurseur(&curseur, &info) == OK && info == 99);
+      assert(!estDansListe(&curseur));
+      curseur = curseurEnTete(liste);
+      assert(supprimerCurseur(&curseur, &info) == OK && info == -1);
+      assert(curseur.position == 0 && curseur.element == liste->tete);
+      verifierContenu(liste, attendu + 1, nombre - 2);
+      detruire(liste);
+   }
+   detruire(reference);
+   afficherTestOk("Test curseur");
+}
+
+void testTrier(void) {
+   Liste *liste = initialiser();
+   assert(liste != NULL);
+   trier(liste, NULL);
+   assert(estVide(liste));
+   Info info = 5;
+   assert(insererEnQueue(liste, &info) == OK);
+   trier(liste, comparerCles);
+   verifierContenu(liste, &info, 1);
+   detruire(liste);
+
+   // assez d'infos pour plusieurs blocs triés sur la pile puis fusionnés, avec
+   // des clés répétées : cle * 100000 + rang d'origine
+   enum { NOMBRE = 20000, CLES = 100 };
+   Info *infos = (Info *) malloc(NOMBRE * sizeof(Info));
+   Info *attendu = (Info *) malloc(NOMBRE * sizeof(Info));
+   assert(infos != NULL && attendu != NULL);
+   unsigned graine = 1;
+   for (int i = 0; i < NOMBRE; i++) {
+      graine = graine * 1103515245u + 12345u;
+      infos[i] = (Info) ((graine >> 16) % CLES) * 100000 + i;
+   }
+   // tri stable par clé attendu : les rangs d'origine restent croissants
+   size_t nombre = 0;
+   for (int cle = 0; cle < CLES; cle++) {
+      for (int i = 0; i < NOMBRE; i++) {
+         if (infos[i] / 100000 == cle) {
+            attendu[nombre++] = infos[i];
+         }
+      }
+   }
+
+   for (int avecIndex = 0; avecIndex < 2; avecIndex++) {
+      liste = initialiser();
+      assert(liste != NULL);
+      for (int i = 0; i < NOMBRE; i++) {
+         assert(insererEnQueue(liste, &infos[i]) == OK);
+      }
+      if (avecIndex) {
+         assert(activerIndexPositionnel(liste) == OK);
+      }
+      Element *tete = liste->tete;
+      Element *queue = liste->queue;
+      trier(liste, comparerCles);
+      // les infos sont déplacées, pas les elements
+      assert(liste->tete == tete && liste->queue == queue);
+      verifierContenu(liste, attendu, NOMBRE);
+      Info precedente = INT_MAX;
+      for (Element *element = liste->queue; element; element = element->precedent) {
+         assert(element->info <= precedente);
+         precedente = element->info;
+      }
+
+      // tri par valeurs : les rangs d'origine départagent les clés égales
+      trier(liste, NULL);
+      verifierContenu(liste, attendu, NOMBRE);
+      detruire(liste);
+   }
+   free(infos);
+   free(attendu);
+   afficherTestOk("Test trier()");
+}
+
+void testRestitutionDifferee(void) {
+   enum { NOMBRE = 1000 };
+   Info infos[NOMBRE];
+   for (int i = 0; i < NOMBRE; i++) {
+      infos[i] = i;
+   }
+
+   // les listes sont construites element par element, sans reservoir.
+   // Restitution par l'appelant, au rythme choisi
+   assert(activerRestitutionDifferee(false) == OK);
+   assert(!restitutionsEnAttente());
+   Liste *liste = initialiser();
+   assert(liste != NULL);
+   for (int i = 0; i < NOMBRE; i++) {
+      assert(insererEnQueue(liste, &infos[i]) == OK);
+   }
+   vider(liste, 10);
+   verifierContenu(liste, infos, 10);
+   assert(restitutionsEnAttente());
+   assert(restituerElementsDifferes(100) == 100);
+   assert(restitutionsEnAttente());
+   supprimerSelonCritere(liste, positionEstPaire);
+   assert(longueur(liste) == 5);
+   assert(restituerElementsDifferes(NOMBRE) == NOMBRE - 10 - 100 + 5);
+   assert(!restitutionsEnAttente());
+   assert(restituerElementsDifferes(NOMBRE) == 0);
+   // les listes avec reservoir ne sont pas concernées
+   // (insererTableauEnQueue donne un reservoir privé à une liste vide)
+   Liste *listeReservoir = initialiser();
+   assert(listeReservoir != NULL);
+   assert(insererTableauEnQueue(listeReservoir, infos, NOMBRE) == OK);
+   vider(listeReservoir, 0);
+   assert(!restitutionsEnAttente());
+   detruire(listeReservoir);
+   assert(activerRestitutionDifferee(true) == OK);
+   detruire(liste);
+   attendreRestitutionsDifferees();
+   desactiverRestitutionDifferee();
+   assert(!restitutionsEnAttente());
+
+   // restitution en arrière-plan
+   assert(activerRestitutionDifferee(true) == OK);
+   for (int i = 0; i < 10; i++) {
+      liste = initialiser();
+      assert(liste != NULL);
+      for (int i = 0; i < NOMBRE; i++) {
+      assert(insererEnQueue(liste, &infos[i]) == OK);
+   }
+      vider(liste, (size_t) i);
+      verifierContenu(liste, infos, (size_t) i);
+      assert(insererEnQueue(liste, &infos[0]) == OK);
+      detruire(liste);
+   }
+   attendreRestitutionsDifferees();
+   assert(!restitutionsEnAttente());
+   liste = initialiser();
+   assert(liste != NULL);
+   for (int i = 0; i < NOMBRE; i++) {
+      assert(insererEnQueue(liste, &infos[i]) == OK);
+   }
+   detruire(liste);
+   // les elements encore en attente sont restitués avant l'arrêt du thread
+   desactiverRestitutionDifferee();
+   assert(!restitutionsEnAttente());
+
+   // de nouveau immédiate
+   liste = initialiser();
+   assert(liste != NULL);
+   for (int i = 0; i < NOMBRE; i++) {
+      assert(insererEnQueue(liste, &infos[i]) == OK);
+   }
+   vider(liste, 0);
+   assert(!restitutionsEnAttente());
+   detruire(liste);
+   afficherTestOk("Test restitution differee");
+}
+
+void testCompacter(void) {
+   Liste *liste = initialiser();
+   assert(liste != NULL);
+   assert(compacter(liste) == OK);
+   assert(estVide(liste));
+
+   // insertions en tete et en queue entremêlées avec celles d'une autre liste :
+   // les elements sont dispersés dans le tas
+   enum { NOMBRE = 1000 };
+   Info attendu[NOMBRE];
+   Liste *autre = initialiser();
+   assert(autre != NULL);
+   for (Info i = 0; i < NOMBRE / 2; i++) {
+      Info info = NOMBRE / 2 - 1 - i;
+      assert(insererEnTete(liste, &info) == OK);
+      assert(insererEnQueue(autre, &i) == OK);
+      info = NOMBRE / 2 + i;
+      assert(insererEnQueue(liste, &info) == OK);
+   }
+   for (Info i = 0; i < NOMBRE; i++) {
+      attendu[i] = i;
+   }
+   assert(activerIndexPositionnel(liste) == OK);
+   assert(activerEmpreinte(liste) == OK);
+   assert(compacter(liste) == OK);
+   verifierContenu(liste, attendu, NOMBRE);
+   Element *element = liste->tete;
+   for (size_t i = 0; i < NOMBRE; i++, element = element->suivant) {
+      assert(element == liste->tete + i);
+      assert(element->precedent == (i ? liste->tete + i - 1 : NULL));
+      Info info;
+      assert(elementA(liste, i, &info) == OK && info == attendu[i]);
+   }
+   assert(liste->queue == liste->tete + NOMBRE - 1);
+   // la liste reste modifiable normalement
+   Info info = NOMBRE;
+   assert(insererEnQueue(liste, &info) == OK);
+   assert(supprimerEnQueue(liste, &info) == OK && info == NOMBRE);
+   assert(supprimerEnTete(liste, &info) == OK && info == 0);
+   assert(insererEnTete(liste, &info) == OK);
+   verifierContenu(liste, attendu, NOMBRE);
+   // compacter une liste deja dotée d'un reservoir privé
+   assert(compacter(liste) == OK);
+   verifierContenu(liste, attendu, NOMBRE);
+   Liste *copie = initialiser();
+   assert(copie != NULL);
+   assert(insererTableauEnQueue(copie, attendu, NOMBRE) == OK);
+   assert(sontEgales(liste, copie));
+   detruire(copie);
+   detruire(liste);
+   detruire(autre);
+
+   // reservoir partagé : les anciens elements lui sont rendus
+   ReservoirElements *reservoir = creerReservoir(64);
+   assert(reservoir != NULL);
+   liste = initialiserAvecReservoir(reservoir);
+   autre = initialiserAvecReservoir(reservoir);
+   assert(liste != NULL && autre != NULL);
+   for (Info i = 0; i < NOMBRE; i++) {
+      assert(insererEnQueue(liste, &i) == OK);
+      assert(insererEnQueue(autre, &i) == OK);
+   }
+   assert(compacter(liste) == OK);
+   assert(liste->reservoir == reservoir);
+   verifierContenu(liste, attendu, NOMBRE);
+   verifierContenu(autre, attendu, NOMBRE);
+   for (size_t i = 1; i < NOMBRE; i++) {
+      assert(liste->tete[i - 1].suivant == &liste->tete[i]);
+   }
+   detruire(liste);
+   detruire(autre);
+   libererReservoir(reservoir);
+   afficherTestOk("Test compacter()");
+}
+
+void testCachesElements(void) {
+   activerCachesElements();
+   Liste *liste = initialiser();
+   assert(liste != NULL);
+   Info info = 5;
+   assert(insererEnTete(liste, &info) == OK);
+   Element *element = liste->tete;
+   assert(supprimerEnTete(liste, &info) == OK && info == 5);
+   // l'element restitué est repris du cache, remis à 0
+   assert(insererEnTete(liste, NULL) == OK);
+   assert(liste->tete == element && element->info == 0);
+   assert(element->suivant == NULL && element->precedent == NULL);
+   detruire(liste);
+
+   enum { THREADS = 8 };
+   pthread_t threads[THREADS];
+   long long sommes[THREADS];
+   for (int i = 0; i < THREADS; i++) {
+      assert(pthread_create(&threads[i], NULL, modifierListeDuThread,
+                            &sommes[i]) == 0);
+   }
+   for (int i = 0; i < THREADS; i++) {
+      pthread_join(threads[i], NULL);
+      assert(sommes[i] == sommes[0] && sommes[i] >= 0);
+   }
+   // les caches des threads terminés ont rejoint la réserve commune
+   long long somme;
+   modifierListeDuThread(&somme);
+   assert(somme == sommes[0]);
+
+   // un thread qui ne fait qu'allouer reprend un lot de la réserve : le reste du
+   // lot (63 elements, moins d'un lot) est restitué à la fin du thread
+   liste = initialiser();
+   assert(liste != NULL);
+   for (Info i = 0; i < 256; i++) {
+      assert(insererEnQueue(liste, &i) == OK);
+   }
+   vider(liste, 0);
+   reinitialiserInstrumentation();
+   pthread_t producteur;
+   assert(pthread_create(&producteur, NULL, insererDepuisUnThread, liste) == 0);
+   assert(pthread_join(producteur, NULL) == 0);
+   assert(longueur(liste) == 1);
+   if (instrumentationActive()) {
+      Instrumentation instrumentation;
+      lireInstrumentation(&instrumentation);
+      assert(instrumentation.elementsAlloues == 1);
+      assert(instrumentation.allocationsSysteme == 0);
+      assert(instrumentation.liberationsSysteme == 63);
+   }
+   detruire(liste);
+
+   desactiverCachesElements();
+   modifierListeDuThread(&somme);
+   assert(somme == sommes[0]);
+   afficherTestOk("Test caches d'elements");
+}
+
+void *modifierListeDuThread(void *argument) {
+   long long *somme = (long long *) argument;
+   Liste *liste = initialiser();
+   assert(liste != NULL);
+   // la liste grandit et rétrécit par vagues : les elements passent par le
+   // cache et la réserve
+   for (Info vague = 0; vague < 20; vague++) {
+      for (Info i = 0; i < 500; i++) {
+         Info info = vague * 1000 + i;
+         assert((i % 2 ? insererEnTete(liste, &info) : insererEnQueue(liste, &info))
+                == OK);
+      }
+      for (Info i = 0; i < 400; i++) {
+         assert((i % 3 ? supprimerEnQueue(liste, NULL) : supprimerEnTete(liste, NULL))
+                == OK);
+      }
+   }
+   *somme = 0;
+   size_t nombre = 0;
+   for (Element *element = liste->tete; element; element = element->suivant) {
+      *somme += element->info;
+      nombre++;
+   }
+   if (nombre != longueur(liste) || nombre != 20 * 100) {
+      *somme = -1;
+   }
+   detruire(liste);
+   return NULL;
+}
+
+void *insererDepuisUnThread(void *argument) {
+   Info info = 1;
+   assert(insererEnQueue((Liste *) argument, &info) == OK);
+   return NULL;
+}
+
+void accumulerSommePonderee(void *partiel, size_t position, const Info *info) {
+   *(uint64_t *) partiel += (uint64_t) (position + 1) * (uint64_t) *info;
+}
+
+void combinerSommes(void *resultat, const void *partiel) {
+   *(uint64_t *) resultat += *(const uint64_t *) partiel;
+}
+
+int comparerCles(const Info *info1, const Info *info2) {
+   Info cle1 = *info1 / 100000;
+   Info cle2 = *info2 / 100000;
+   return (cle1 > cle2) - (cle1 < cle2);
+}
+#endif
+
+bool estEntre3et7(size_t pos, const Info *val) {
+   (void) pos; //eviter le warning de parametre non utilise
+   return *val < 3 || *val > 7;
+}
+
+bool positionEstPaire(size_t pos, const Info *val) {
+   (void) val; //eviter le warning de parametre non utilise
+   return pos % 2 == 0;
+}
+
+bool positionPlusInfoMultipleDe3(size_t pos, const Info *val) {
+   return (pos + (size_t) *val) % 3 == 0;
+}
+
+bool suppressionComplete(size_t pos, const Info *val) {
+   (void) pos; //eviter le warning de parametre non utilise
+   (void) val;
+   return true;
+}
+
+void estEntre3et7ParLot(size_t positionDebut, const Info *infos, size_t nombre,
+                        bool *aSupprimer) {
+   (void) positionDebut; //eviter le warning de parametre non utilise
+   // boucle sans branchement, vectorisable par le compilateur
+   for (size_t i = 0; i < nombre; i++) {
+      aSupprimer[i] = infos[i] < 3 || infos[i] > 7;
+   }
+}
+
+void positionEstPaireParLot(size_t positionDebut, const Info *infos, size_t nombre,
+                            bool *aSupprimer) {
+   (void) infos; //eviter le warning de parametre non utilise
+   for (size_t i = 0; i < nombre; i++) {
+      aSupprimer[i] = (positionDebut + i) % 2 == 0;
+   }
 }
@@ -0,0 +1,485 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : mesures.c
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Mesures de débit et de latence des opérations de base de la
+                  librairie de listes, pour des listes de 1e3 éléments à une
+                  taille maximale, par puissances de 10. Les résultats sont
+                  écrits sur la sortie standard en CSV (par défaut) ou en JSON,
+                  pour être comparés d'une version de la librairie à l'autre.
+
+ Remarque(s)    : Les mesures n'ont de sens que si la librairie est compilée en
+                  mode Release (cmake -DCMAKE_BUILD_TYPE=Release).
+                  Utilisation : Labo_2_mesures [taille maximale] [csv|json]
+                  Les opérations répétées (insertions, suppressions, longueur)
+                  sont exécutées en deux passes : la première, sans
+                  chronométrage individuel, donne le débit ; dans la seconde,
+                  un appel sur pas est chronométré, de sorte qu'au plus
+                  TAILLE_ECHANTILLON latences soient conservées. Une latence inclut le coût de la lecture de
+                  l'horloge (quelques dizaines de ns). Les listes de départ sont
+                  construites par insererTableauEnQueue.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "listes_dynamiques.h"
+
+// Taille maximale par défaut des listes mesurées
+const size_t MESURES_TAILLE_MAXIMALE = 10000000;
+
+// Taille minimale des listes mesurées
+const size_t MESURES_TAILLE_MINIMALE = 1000;
+
+// Nombre maximal de latences conservées par mesure
+#define TAILLE_ECHANTILLON 100000
+
+// Nombre d'appels des opérations en O(n) (vider, supprimerSelonCritere,
+// sontEgales) pour chaque paramètre
+#define REPETITIONS 5
+
+// Nombre maximal d'appels mesurés de longueur
+#define APPELS_LONGUEUR 1000000
+
+#ifdef LISTES_DEROULEES
+#define REPRESENTATION "deroulee"
+#else
+#define REPRESENTATION "classique"
+#endif
+
+typedef enum {
+   CSV, JSON
+} Format;
+
+// Résultat d'une mesure en cours
+typedef struct {
+   uint64_t latences[TAILLE_ECHANTILLON]; // en nanosecondes
+   size_t nombreLatences;
+   size_t pas;                            // un appel sur pas est chronométré
+   bool chronometrer;                     // false : aucun appel chronométré
+   size_t appels;
+   size_t elements;                       // éléments traités par les appels
+   uint64_t duree;                        // durée totale des appels (ns)
+} Mesure;
+
+// Pourcentage des positions supprimées par critereSelectivite
+static unsigned pourcentageSupprime;
+
+/**
+ * @return l'instant actuel en nanosecondes (entier : un double exprimant
+ * l'instant en secondes n'a qu'une précision de l'ordre de 200 ns)
+ */
+uint64_t maintenant(void);
+
+/**
+ * Prépare mesure pour appels appels dont au plus TAILLE_ECHANTILLON sont
+ * chronométrés individuellement
+ * @param mesure
+ * @param appels nombre d'appels prévus
+ */
+void commencerMesure(Mesure *mesure, size_t appels);
+
+/**
+ * Ajoute à mesure la latence d'un appel chronométré
+ * @param mesure
+ * @param latence durée de l'appel en nanosecondes
+ */
+void ajouterLatence(Mesure *mesure, uint64_t latence);
+
+// Exécute OPERATION (l'appel numéro I) en la chronométrant si c'est l'un des
+// appels échantillonnés de MESURE
+#define APPEL_MESURE(MESURE, I, OPERATION)                   \
+   do {                                                      \
+      if (!(MESURE)->chronometrer || (I) % (MESURE)->pas) {  \
+         OPERATION;                                          \
+      } else {                                               \
+         uint64_t debutAppel = maintenant();                 \
+         OPERATION;                                          \
+         ajouterLatence((MESURE), maintenant() - debutAppel); \
+      }                                                      \
+   } while (0)
+
+/**
+ * Écrit une ligne de résultat (CSV) ou un objet (JSON) décrivant mesure
+ * @param format
+ * @param operation nom de l'opération mesurée
+ * @param parametre paramètre de l'opération ("-" si aucun)
+ * @param taille taille de la liste mesurée
+ * @param mesure mesure terminée ; ses latences sont triées
+ */
+void ecrireResultat(Format format, const char *operation, const char *parametre,
+                    size_t taille, Mesure *mesure);
+
+/**
+ * Comparateur de latences pour qsort
+ * @param a uint64_t
+ * @param b uint64_t
+ * @return négatif, nul ou positif selon que a est inférieure, égale ou
+ * supérieure à b
+ */
+int comparerLatences(const void *a, const void *b);
+
+/**
+ * @param latences latences triées
+ * @param nombre nombre de latences (non nul)
+ * @param centile centile souhaité, entre 0 et 1
+ * @return la latence du centile centile, en nanosecondes
+ */
+uint64_t latenceCentile(const uint64_t *latences, size_t nombre, double centile);
+
+/**
+ * Construit une liste des taille premières infos de infos
+ * @param infos
+ * @param taille
+ * @return la liste ou NULL en cas de mémoire insuffisante
+ */
+Liste *construire(const Info *infos, size_t taille);
+
+/**
+ * Critère supprimant pourcentageSupprime pour cent des positions
+ * @param position position dans la liste
+ * @param info info de l'element
+ * @return true si l'element doit être supprimé
+ */
+bool critereSelectivite(size_t position, const Info *info);
+
+/**
+ * Mesure insererEnQueue, longueur, supprimerEnTete, insererEnTete et
+ * supprimerEnQueue (taille appels chacune, depuis une liste vide)
+ * @param format
+ * @param mesures tableau de 3 mesures à réutiliser
+ * @param taille
+ * @return false en cas de mémoire insuffisante
+ */
+bool mesurerExtremites(Format format, Mesure *mesures, size_t taille);
+
+/**
+ * Mesure vider à 0, 25, 50, 75 et 99 % de la liste
+ * @param format
+ * @param mesure mesure à réutiliser
+ * @param infos infos des listes construites
+ * @param taille
+ * @return false en cas de mémoire insuffisante
+ */
+bool mesurerVider(Format format, Mesure *mesure, const Info *infos, size_t taille);
+
+/**
+ * Mesure supprimerSelonCritere supprimant 0, 10, 50, 90 et 100 % des elements
+ * @param format
+ * @param mesure mesure à réutiliser
+ * @param infos infos des listes construites
+ * @param taille
+ * @return false en cas de mémoire insuffisante
+ */
+bool mesurerCritere(Format format, Mesure *mesure, const Info *infos, size_t taille);
+
+/**
+ * Mesure sontEgales sur des listes égales, différant par leur dernière info et
+ * de longueurs différentes
+ * @param format
+ * @param mesure mesure à réutiliser
+ * @param infos infos des listes construites
+ * @param taille
+ * @return false en cas de mémoire insuffisante
+ */
+bool mesurerSontEgales(Format format, Mesure *mesure, const Info *infos,
+                       size_t taille);
+
+int main(int argc, char *argv[]) {
+   size_t tailleMaximale = MESURES_TAILLE_MAXIMALE;
+   Format format = CSV;
+   if (argc > 1) {
+      tailleMaximale = (size_t) strtoull(argv[1], NULL, 10);
+   }
+   if (argc > 2 && !strcmp(argv[2], "json")) {
+      format = JSON;
+   }
+
+   Info *infos = (Info *) malloc(tailleMaximale * sizeof(Info));
+   Mesure *mesures = (Mesure *) malloc(3 * sizeof(Mesure));
+   if (!infos || !mesures) {
+      fprintf(stderr, "memoire insuffisante\n");
+      free(infos);
+      free(mesures);
+      return EXIT_FAILURE;
+   }
+   for (size_t i = 0; i < tailleMaximale; i++) {
+      infos[i] = (Info) i;
+   }
+
+   if (format == CSV) {
+      printf("representation,operation,parametre,taille,appels,duree_s,"
+             "appels_par_s,elements_par_s,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n");
+   } else {
+      printf("[");
+   }
+   bool succes = true;
+   for (size_t taille = MESURES_TAILLE_MINIMALE; succes && taille <= tailleMaximale;
+        taille *= 10) {
+      succes = mesurerExtremites(format, mesures, taille) &&
+               mesurerVider(format, mesures, infos, taille) &&
+               mesurerCritere(format, mesures, infos, taille) &&
+               mesurerSontEgales(format, mesures, infos, taille);
+   }
+   if (format == JSON) {
+      printf("\n]\n");
+   }
+   if (!succes) {
+      fprintf(stderr, "memoire insuffisante\n");
+   }
+
+   free(infos);
+   free(mesures);
+   return succes ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+uint64_t maintenant(void) {
+   struct timespec instant;
+   timespec_get(&instant, TIME_UTC);
+   return (uint64_t) instant.tv_sec * 1000000000u + (uint64_t) instant.tv_nsec;
+}
+
+void commencerMesure(Mesure *mesure, size_t appels) {
+   mesure->nombreLatences = 0;
+   mesure->pas = (appels + TAILLE_ECHANTILLON - 1) / TAILLE_ECHANTILLON;
+   if (!mesure->pas) {
+      mesure->pas = 1;
+   }
+   mesure->chronometrer = true;
+   mesure->appels = 0;
+   mesure->elements = 0;
+   mesure->duree = 0;
+}
+
+void ajouterLatence(Mesure *mesure, uint64_t latence) {
+   if (mesure->nombreLatences < TAILLE_ECHANTILLON) {
+      mesure->latences[mesure->nombreLatences++] = latence;
+   }
+}
+
+int comparerLatences(const void *a, const void *b) {
+   uint64_t latenceA = *(const uint64_t *) a;
+   uint64_t latenceB = *(const uint64_t *) b;
+   return (latenceA > latenceB) - (latenceA < latenceB);
+}
+
+uint64_t latenceCentile(const uint64_t *latences, size_t nombre, double centile) {
+   size_t rang = (size_t) (centile * (double) nombre + 0.999999);
+   return latences[rang ? rang - 1 : 0];
+}
+
+void ecrireResultat(Format format, const char *operation, const char *parametre,
+                    size_t taille, Mesure *mesure) {
+   static bool premier = true;
+   qsort(mesure->latences, mesure->nombreLatences, sizeof(uint64_t),
+         comparerLatences);
+   uint64_t centiles[5] = {0};
+   if (mesure->nombreLatences) {
+      const uint64_t *latences = mesure->latences;
+      size_t nombre = mesure->nombreLatences;
+      centiles[0] = latenceCentile(latences, nombre, 0.5);
+      centiles[1] = latenceCentile(latences, nombre, 0.9);
+      centiles[2] = latenceCentile(latences, nombre, 0.99);
+      centiles[3] = latenceCentile(latences, nombre, 0.999);
+      centiles[4] = latences[nombre - 1];
+   }
+   double duree = mesure->duree ? (double) mesure->duree / 1e9 : 1e-9;
+
+   if (format == CSV) {
+      printf("%s,%s,%s,%zu,%zu,%.9f,%.0f,%.0f,%llu,%llu,%llu,%llu,%llu\n",
+             REPRESENTATION, operation, parametre, taille, mesure->appels,
+             (double) mesure->duree / 1e9, (double) mesure->appels / duree,
+             (double) mesure->elements / duree, (unsigned long long) centiles[0],
+             (unsigned long long) centiles[1], (unsigned long long) centiles[2],
+             (unsigned long long) centiles[3], (unsigned long long) centiles[4]);
+   } else {
+      printf("%s\n  {\"representation\": \"%s\", \"operation\": \"%s\", "
+             "\"parametre\": \"%s\", \"taille\": %zu, \"appels\": %zu, "
+             "\"duree_s\": %.9f, \"appels_par_s\": %.0f, \"elements_par_s\": %.0f, "
+             "\"p50_ns\": %llu, \"p90_ns\": %llu, \"p99_ns\": %llu, "
+             "\"p999_ns\": %llu, \"max_ns\": %llu}", premier ? "" : ",",
+             REPRESENTATION, operation, parametre, taille, mesure->appels,
+             (double) mesure->duree / 1e9, (double) mesure->appels / duree,
+             (double) mesure->elements / duree, (unsigned long long) centiles[0],
+             (unsigned long long) centiles[1], (unsigned long long) centiles[2],
+             (unsigned long long) centiles[3], (unsigned long long) centiles[4]);
+   }
+   premier = false;
+   fflush(stdout);
+}
+
+Liste *construire(const Info *infos, size_t taille) {
+   Liste *liste = initialiser();
+   if (liste && insererTableauEnQueue(liste, infos, taille) != OK) {
+      detruire(liste);
+      return NULL;
+   }
+   return liste;
+}
+
+bool critereSelectivite(size_t position, const Info *info) {
+   (void) info; //eviter le warning de parametre non utilise
+   return position % 100 < pourcentageSupprime;
+}
+
+bool mesurerExtremites(Format format, Mesure *mesures, size_t taille) {
+   Liste *liste = initialiser();
+   if (!liste) {
+      return false;
+   }
+   Mesure *insertion = &mesures[0];
+   Mesure *lecture = &mesures[1];
+   Mesure *suppression = &mesures[2];
+   size_t appelsLongueur = taille < APPELS_LONGUEUR ? taille : APPELS_LONGUEUR;
+   volatile size_t total = 0;
+   bool succes = true;
+   for (int enTete = 0; succes && enTete < 2; enTete++) {
+      commencerMesure(insertion, taille);
+      commencerMesure(lecture, appelsLongueur);
+      commencerMesure(suppression, taille);
+      // passe 0 : débit, sans chronométrer d'appel ; passe 1 : latences
+      for (int passe = 0; succes && passe < 2; passe++) {
+         insertion->chronometrer = lecture->chronometrer =
+            suppression->chronometrer = passe;
+
+         uint64_t debut = maintenant();
+         for (size_t i = 0; succes && i < taille; i++) {
+            Info info = (Info) i;
+            APPEL_MESURE(insertion, i, succes = (enTete ? insererEnTete(liste, &info)
+                                                        : insererEnQueue(liste, &info)) == OK);
+         }
+         if (!passe) {
+            insertion->duree = maintenant() - debut;
+         }
+
+         debut = maintenant();
+         for (size_t i = 0; succes && i < appelsLongueur; i++) {
+            APPEL_MESURE(lecture, i, total += longueur(liste));
+         }
+         if (!passe) {
+            lecture->duree = maintenant() - debut;
+         }
+
+         // suppressions à l'extrémité opposée : la liste est parcourue comme
+         // une file
+         debut = maintenant();
+         for (size_t i = 0; succes && i < taille; i++) {
+            APPEL_MESURE(suppression, i, enTete ? supprimerEnQueue(liste, NULL)
+                                                : supprimerEnTete(liste, NULL));
+         }
+         if (!passe) {
+            suppression->duree = maintenant() - debut;
+         }
+      }
+      if (!succes) {
+         break;
+      }
+      insertion->appels = insertion->elements = taille;
+      lecture->appels = lecture->elements = appelsLongueur;
+      suppression->appels = suppression->elements = taille;
+      ecrireResultat(format, enTete ? "insererEnTete" : "insererEnQueue", "-",
+                     taille, insertion);
+      if (!enTete) {
+         ecrireResultat(format, "longueur", "-", taille, lecture);
+      }
+      ecrireResultat(format, enTete ? "supprimerEnQueue" : "supprimerEnTete", "-",
+                     taille, suppression);
+   }
+   detruire(liste);
+   return succes;
+}
+
+bool mesurerVider(Format format, Mesure *mesure, const Info *infos, size_t taille) {
+   const unsigned pourcentages[] = {0, 25, 50, 75, 99};
+   for (size_t p = 0; p < sizeof(pourcentages) / sizeof(pourcentages[0]); p++) {
+      size_t position = taille / 100 * pourcentages[p];
+      commencerMesure(mesure, REPETITIONS);
+      for (size_t r = 0; r < REPETITIONS; r++) {
+         Liste *liste = construire(infos, taille);
+         if (!liste) {
+            return false;
+         }
+         uint64_t debut = maintenant();
+         vider(liste, position);
+         uint64_t duree = maintenant() - debut;
+         ajouterLatence(mesure, duree);
+         mesure->duree += duree;
+         mesure->elements += taille - position;
+         mesure->appels++;
+         detruire(liste);
+      }
+      char parametre[16];
+      snprintf(parametre, sizeof(parametre), "position=%u%%", pourcentages[p]);
+      ecrireResultat(format, "vider", parametre, taille, mesure);
+   }
+   return true;
+}
+
+bool mesurerCritere(Format format, Mesure *mesure, const Info *infos, size_t taille) {
+   const unsigned pourcentages[] = {0, 10, 50, 90, 100};
+   for (size_t p = 0; p < sizeof(pourcentages) / sizeof(pourcentages[0]); p++) {
+      pourcentageSupprime = pourcentages[p];
+      commencerMesure(mesure, REPETITIONS);
+      for (size_t r = 0; r < REPETITIONS; r++) {
+         Liste *liste = construire(infos, taille);
+         if (!liste) {
+            return false;
+         }
+         uint64_t debut = maintenant();
+         supprimerSelonCritere(liste, critereSelectivite);
+         uint64_t duree = maintenant() - debut;
+         ajouterLatence(mesure, duree);
+         mesure->duree += duree;
+         mesure->elements += taille;
+         mesure->appels++;
+         detruire(liste);
+      }
+      char parametre[16];
+      snprintf(parametre, sizeof(parametre), "supprime=%u%%", pourcentages[p]);
+      ecrireResultat(format, "supprimerSelonCritere", parametre, taille, mesure);
+   }
+   return true;
+}
+
+bool mesurerSontEgales(Format format, Mesure *mesure, const Info *infos,
+                       size_t taille) {
+   Liste *l1 = construire(infos, taille);
+   Liste *l2 = construire(infos, taille);
+   if (!l1 || !l2) {
+      detruire(l1);
+      detruire(l2);
+      return false;
+   }
+   const char *cas[] = {"egales", "derniere differente", "longueurs differentes"};
+   for (size_t c = 0; c < sizeof(cas) / sizeof(cas[0]); c++) {
+      if (c == 1) {
+         Info info = -1;
+         supprimerEnQueue(l2, NULL);
+         insererEnQueue(l2, &info);
+      } else if (c == 2) {
+         supprimerEnQueue(l2, NULL);
+      }
+      commencerMesure(mesure, REPETITIONS);
+      volatile bool egales = false;
+      for (size_t r = 0; r < REPETITIONS; r++) {
+         uint64_t debut = maintenant();
+         egales = sontEgales(l1, l2);
+         uint64_t duree = maintenant() - debut;
+         ajouterLatence(mesure, duree);
+         mesure->duree += duree;
+         mesure->elements += taille;
+         mesure->appels++;
+      }
+      (void) egales;
+      ecrireResultat(format, "sontEgales", cas[c], taille, mesure);
+   }
+   detruire(l1);
+   detruire(l2);
+   return true;
+}
@@ -0,0 +1,311 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : persistance.c
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Ce fichier implémente la sauvegarde, le chargement et la
+                  projection en mémoire des listes (persistance.h).
+
+ Remarque(s)    : Les listes sont parcourues par tronçons de TAILLE_TRONCON
+                  infos, copiées dans un tableau sur la pile : c'est la seule
+                  partie de ce fichier qui dépend de la représentation de liste.
+                  La projection utilise mmap sur les plateformes POSIX.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+#if defined(__unix__) || defined(__APPLE__)
+#define PROJECTION_MMAP
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "persistance.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef PROJECTION_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Nombre d'infos écrites, lues ou comparées à la fois (64 kio avec des int)
+#define TAILLE_TRONCON 16384
+
+#define SIGNATURE "LISTEDYN"
+#define VERSION_FORMAT 1
+// Lu 0x04030201 sur une machine d'ordre des octets inverse
+#define MARQUEUR_ORDRE_OCTETS 0x01020304u
+
+typedef struct {
+   char signature[8];
+   uint32_t version;
+   uint32_t tailleInfo;
+   uint32_t ordreOctets;
+   uint32_t reserve;          // 0, complète l'en-tête à 32 octets
+   uint64_t longueur;
+} EnTete;
+
+// Les infos suivent directement l'en-tête : elles sont alignées dans une
+// projection, qui commence sur une page
+_Static_assert(sizeof(EnTete) == 32, "en-tete de 32 octets");
+_Static_assert(sizeof(EnTete) % _Alignof(Info) == 0, "infos alignees");
+
+struct listeProjetee {
+   const Info *infos;
+   size_t taille;
+   void *donnees;             // début de la projection (ou du tableau)
+   size_t octets;             // taille de la projection
+};
+
+/**
+ * Appelle traiter pour chaque tronçon de liste, de la tête à la queue. Chaque
+ * tronçon compte TAILLE_TRONCON infos, sauf le dernier.
+ * @param liste
+ * @param traiter fonction appelée pour chaque tronçon ; le parcours s'arrête dès
+ * qu'elle renvoie false
+ * @param contexte paramètre transmis à traiter
+ * @return false si traiter a renvoyé false, true sinon
+ */
+static bool parcourirParTroncons(const Liste *liste,
+                                 bool (*traiter)(const Info *infos, size_t nombre,
+                                                 void *contexte),
+                                 void *contexte);
+
+/**
+ * Écrit un tronçon dans un flux (cf. parcourirParTroncons)
+ * @param infos
+ * @param nombre nombre d'infos à écrire
+ * @param contexte flux (FILE *)
+ * @return true si l'écriture a réussi, false sinon
+ */
+static bool ecrireTroncon(const Info *infos, size_t nombre, void *contexte);
+
+/**
+ * Compare un tronçon à la suite des infos d'une liste projetée
+ * (cf. parcourirParTroncons)
+ * @param infos
+ * @param nombre nombre d'infos à comparer
+ * @param contexte pointeur (const Info **) sur les prochaines infos projetées,
+ * avancé de nombre
+ * @return true si les infos sont égales, false sinon
+ */
+static bool comparerTroncon(const Info *infos, size_t nombre, void *contexte);
+
+/**
+ * Vérifie qu'un en-tête lu est celui d'une liste écrite par sauvegarder sur une
+ * machine compatible
+ * @param entete
+ * @return true si l'en-tête est valide, false sinon
+ */
+static bool enTeteValide(const EnTete *entete);
+
+bool parcourirParTroncons(const Liste *liste,
+                          bool (*traiter)(const Info *infos, size_t nombre,
+                                          void *contexte),
+                          void *contexte) {
+   Info troncon[TAILLE_TRONCON];
+   size_t nombre = 0;
+#ifdef LISTES_DEROULEES
+   for (const Element *element = liste->tete; element; element = element->suivant) {
+      const Info *infos = element->infos + element->debut;
+      size_t restantes = element->nombre;
+      while (restantes) {
+         size_t copiees = TAILLE_TRONCON - nombre < restantes
+                          ? TAILLE_TRONCON - nombre : restantes;
+         memcpy(troncon + nombre, infos, copiees * sizeof(Info));
+         infos += copiees;
+         restantes -= copiees;
+         nombre += copiees;
+         if (nombre == TAILLE_TRONCON) {
+            if (!traiter(troncon, nombre, contexte)) {
+               return false;
+            }
+            nombre = 0;
+         }
+      }
+   }
+#else
+   for (const Element *element = liste->tete; element; element = element->suivant) {
+      troncon[nombre++] = element->info;
+      if (nombre == TAILLE_TRONCON) {
+         if (!traiter(troncon, nombre, contexte)) {
+            return false;
+         }
+         nombre = 0;
+      }
+   }
+#endif
+   return !nombre || traiter(troncon, nombre, contexte);
+}
+
+bool ecrireTroncon(const Info *infos, size_t nombre, void *contexte) {
+   return fwrite(infos, sizeof(Info), nombre, (FILE *) contexte) == nombre;
+}
+
+bool comparerTroncon(const Info *infos, size_t nombre, void *contexte) {
+   const Info **projetees = (const Info **) contexte;
+   if (memcmp(infos, *projetees, nombre * sizeof(Info))) {
+      return false;
+   }
+   *projetees += nombre;
+   return true;
+}
+
+bool enTeteValide(const EnTete *entete) {
+   return !memcmp(entete->signature, SIGNATURE, sizeof(entete->signature)) &&
+          entete->version == VERSION_FORMAT &&
+          entete->tailleInfo == sizeof(Info) &&
+          entete->ordreOctets == MARQUEUR_ORDRE_OCTETS &&
+          entete->longueur <= (SIZE_MAX - sizeof(EnTete)) / sizeof(Info);
+}
+
+Status sauvegarder(const Liste *liste, FILE *flux) {
+   EnTete entete = {
+      .version = VERSION_FORMAT,
+      .tailleInfo = sizeof(Info),
+      .ordreOctets = MARQUEUR_ORDRE_OCTETS,
+      .longueur = longueur(liste)
+   };
+   memcpy(entete.signature, SIGNATURE, sizeof(entete.signature));
+   if (fwrite(&entete, sizeof(EnTete), 1, flux) != 1 ||
+       !parcourirParTroncons(liste, ecrireTroncon, flux) || fflush(flux)) {
+      return ERREUR_FICHIER;
+   }
+   return OK;
+}
+
+Status charger(Liste *liste, FILE *flux) {
+   EnTete entete;
+   if (fread(&entete, sizeof(EnTete), 1, flux) != 1) {
+      return ferror(flux) ? ERREUR_FICHIER : FORMAT_NON_VALIDE;
+   }
+   if (!enTeteValide(&entete)) {
+      return FORMAT_NON_VALIDE;
+   }
+
+   size_t tailleInitiale = longueur(liste);
+#ifndef LISTES_DEROULEES
+   // une liste vide sans reservoir s'en voit attribuer un au premier tronçon
+   bool sansReservoir = liste->reservoir == NULL;
+#endif
+   size_t restantes = (size_t) entete.longueur;
+   Info troncon[TAILLE_TRONCON];
+   while (restantes) {
+      size_t nombre = restantes < TAILLE_TRONCON ? restantes : TAILLE_TRONCON;
+      Status status = OK;
+      if (fread(troncon, sizeof(Info), nombre, flux) != nombre) {
+         status = ferror(flux) ? ERREUR_FICHIER : FORMAT_NON_VALIDE;
+      } else {
+         status = insererTableauEnQueue(liste, troncon, nombre);
+      }
+      if (status != OK) {
+         vider(liste, tailleInitiale);
+#ifndef LISTES_DEROULEES
+         if (sansReservoir && liste->reservoir) {
+            libererReservoir(liste->reservoir);
+            liste->reservoir = NULL;
+         }
+#endif
+         return status;
+      }
+      restantes -= nombre;
+   }
+   return OK;
+}
+
+ListeProjetee *projeter(const char *chemin) {
+   ListeProjetee *liste = (ListeProjetee *) malloc(sizeof(ListeProjetee));
+   if (!liste) {
+      return NULL;
+   }
+
+#ifdef PROJECTION_MMAP
+   int descripteur = open(chemin, O_RDONLY);
+   if (descripteur < 0) {
+      free(liste);
+      return NULL;
+   }
+   struct stat etat;
+   if (fstat(descripteur, &etat) || (size_t) etat.st_size < sizeof(EnTete)) {
+      close(descripteur);
+      free(liste);
+      return NULL;
+   }
+   liste->octets = (size_t) etat.st_size;
+   liste->donnees = mmap(NULL, liste->octets, PROT_READ, MAP_PRIVATE, descripteur, 0);
+   // la projection reste valable une fois le fichier fermé
+   close(descripteur);
+   if (liste->donnees == MAP_FAILED) {
+      free(liste);
+      return NULL;
+   }
+#else
+   FILE *flux = fopen(chemin, "rb");
+   long octets = -1;
+   if (!flux || fseek(flux, 0, SEEK_END) || (octets = ftell(flux)) < 0 ||
+       (size_t) octets < sizeof(EnTete) || fseek(flux, 0, SEEK_SET)) {
+      if (flux) {
+         fclose(flux);
+      }
+      free(liste);
+      return NULL;
+   }
+   liste->octets = (size_t) octets;
+   liste->donnees = malloc(liste->octets);
+   if (!liste->donnees ||
+       fread(liste->donnees, 1, liste->octets, flux) != liste->octets) {
+      fclose(flux);
+      free(liste->donnees);
+      free(liste);
+      return NULL;
+   }
+   fclose(flux);
+#endif
+
+   const EnTete *entete = (const EnTete *) liste->donnees;
+   if (!enTeteValide(entete) ||
+       liste->octets != sizeof(EnTete) + (size_t) entete->longueur * sizeof(Info)) {
+      detruireProjetee(liste);
+      return NULL;
+   }
+   liste->taille = (size_t) entete->longueur;
+   liste->infos = (const Info *) (const void *) (entete + 1);
+   return liste;
+}
+
+size_t longueurProjetee(const ListeProjetee *liste) {
+   return liste->taille;
+}
+
+const Info *infosProjetees(const ListeProjetee *liste) {
+   return liste->infos;
+}
+
+bool sontEgalesProjetee(const Liste *liste, const ListeProjetee *projetee) {
+   if (longueur(liste) != projetee->taille) {
+      return false;
+   }
+   const Info *infos = projetee->infos;
+   return parcourirParTroncons(liste, comparerTroncon, &infos);
+}
+
+bool sontEgalesProjetees(const ListeProjetee *liste1, const ListeProjetee *liste2) {
+   return liste1->taille == liste2->taille &&
+          !memcmp(liste1->infos, liste2->infos, liste1->taille * sizeof(Info));
+}
+
+void detruireProjetee(ListeProjetee *liste) {
+   if (!liste) {
+      return;
+   }
+#ifdef PROJECTION_MMAP
+   munmap(liste->donnees, liste->octets);
+#else
+   free(liste->donnees);
+#endif
+   free(liste);
+}
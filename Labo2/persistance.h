@@ -0,0 +1,88 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : persistance.h
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Sauvegarde et chargement d'une liste dans un fichier binaire,
+                  et projection en mémoire (lecture seule) d'un tel fichier.
+
+ Remarque(s)    : Format du fichier : un en-tête de 32 octets (signature
+                  "LISTEDYN", version, taille d'une info, marqueur d'ordre des
+                  octets, longueur de la liste) suivi des infos de la tête à la
+                  queue, contiguës et dans la représentation de la machine. Un
+                  fichier écrit sur une machine d'un autre ordre des octets ou
+                  avec une autre taille d'info est rejeté (FORMAT_NON_VALIDE).
+                  Disponible avec les deux représentations de liste.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+
+#ifndef PERSISTANCE_H
+#define PERSISTANCE_H
+
+#include "listes_dynamiques.h"
+#include <stdio.h>
+
+// Liste en lecture seule dont les infos sont celles d'un fichier projeté en
+// mémoire : aucun element n'est alloué.
+typedef struct listeProjetee ListeProjetee;
+
+// ------------------------------------------------------------------------------
+// Écrit liste dans flux (ouvert en mode binaire), au format décrit ci-dessus.
+// Les infos sont écrites au fil du parcours de liste, par tronçons.
+// Renvoie OK si l'écriture s'est déroulée avec succès, ERREUR_FICHIER sinon.
+Status sauvegarder(const Liste *liste, FILE *flux);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Lit dans flux (ouvert en mode binaire) une liste écrite par sauvegarder et
+// insère ses infos en queue de liste.
+// Renvoie OK si le chargement s'est déroulé avec succès, FORMAT_NON_VALIDE si
+// flux ne contient pas une liste valide (ou est tronqué), ERREUR_FICHIER en cas
+// d'erreur de lecture et MEMOIRE_INSUFFISANTE sinon ; liste n'est alors pas
+// modifiée.
+// N.B. Les infos sont insérées par lots avec insererTableauEnQueue : sans
+// LISTES_DEROULEES, les éléments d'un lot sont alloués de manière contiguë.
+Status charger(Liste *liste, FILE *flux);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Projette en mémoire, en lecture seule, le fichier chemin écrit par sauvegarder.
+// Seules les pages parcourues sont lues : l'ouverture est en O(1).
+// Renvoie NULL si le fichier ne peut pas être ouvert, n'est pas une liste valide
+// ou en cas de mémoire insuffisante.
+// N.B. Sur une plateforme sans mmap, le fichier est lu en entier dans un tableau.
+ListeProjetee *projeter(const char *chemin);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie combien il y a d'infos dans liste, en O(1).
+size_t longueurProjetee(const ListeProjetee *liste);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie les infos de liste, de la tête à la queue, sous forme d'un tableau de
+// longueurProjetee(liste) infos, valable jusqu'à detruireProjetee.
+const Info *infosProjetees(const ListeProjetee *liste);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie true si liste et projetee contiennent les mêmes infos dans le même
+// ordre, false sinon. Des longueurs différentes sont rejetées en O(1).
+bool sontEgalesProjetee(const Liste *liste, const ListeProjetee *projetee);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie true si liste1 et liste2 contiennent les mêmes infos dans le même
+// ordre, false sinon.
+bool sontEgalesProjetees(const ListeProjetee *liste1, const ListeProjetee *liste2);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Supprime la projection de liste puis restitue liste elle-même.
+void detruireProjetee(ListeProjetee *liste);
+// ------------------------------------------------------------------------------
+
+#endif
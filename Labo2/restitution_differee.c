@@ -0,0 +1,192 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : restitution_differee.c
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Ce fichier implémente la restitution différée des éléments
+                  (restitution_differee.h).
+
+ Remarque(s)    : Les chaînes confiées sont raccordées (via suivant) en une seule
+                  chaîne d'attente protégée par un verrou ; le thread
+                  d'arrière-plan la détache en entier puis la restitue hors du
+                  verrou.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+#include "restitution_differee.h"
+#include "listes_dynamiques_internal.h"
+#include "instrumentation_internal.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+static struct {
+   pthread_mutex_t verrou;
+   pthread_cond_t travail;       // des elements attendent ou arrêt demandé
+   pthread_cond_t termine;       // plus rien en attente ni en cours
+   Element *debut;               // chaîne en attente, la plus ancienne en tete
+   Element *fin;
+   bool enCours;                 // le thread restitue une chaîne détachée
+   bool arret;
+   bool enArrierePlan;
+   pthread_t thread;
+} restitution = {
+   .verrou = PTHREAD_MUTEX_INITIALIZER,
+   .travail = PTHREAD_COND_INITIALIZER,
+   .termine = PTHREAD_COND_INITIALIZER
+};
+
+// Lu sans verrou par differerRestitution à chaque restitution de chaîne
+static atomic_bool restitutionActive;
+
+/**
+ * Restitue (free) les elements de la chaîne debut -> ... -> NULL
+ * @param debut premier element de la chaîne
+ */
+static void restituerChaine(Element *debut);
+
+/**
+ * Boucle du thread d'arrière-plan : restitue les chaînes confiées jusqu'à ce
+ * que l'arrêt soit demandé et que plus rien n'attende
+ * @param argument non utilisé
+ * @return NULL
+ */
+static void *restituerEnArrierePlan(void *argument);
+
+void restituerChaine(Element *debut) {
+   while (debut) {
+      Element *tmp = debut;
+      debut = debut->suivant;
+      free(tmp);
+      COMPTER_RESTITUTIONS(0, 1);
+   }
+}
+
+void *restituerEnArrierePlan(void *argument) {
+   (void) argument; //eviter le warning de parametre non utilise
+   pthread_mutex_lock(&restitution.verrou);
+   for (;;) {
+      while (!restitution.debut && !restitution.arret) {
+         pthread_cond_wait(&restitution.travail, &restitution.verrou);
+      }
+      if (!restitution.debut) {
+         break;
+      }
+      Element *debut = restitution.debut;
+      restitution.debut = restitution.fin = NULL;
+      restitution.enCours = true;
+      pthread_mutex_unlock(&restitution.verrou);
+
+      restituerChaine(debut);
+
+      pthread_mutex_lock(&restitution.verrou);
+      restitution.enCours = false;
+      if (!restitution.debut) {
+         pthread_cond_broadcast(&restitution.termine);
+      }
+   }
+   pthread_mutex_unlock(&restitution.verrou);
+   return NULL;
+}
+
+bool differerRestitution(Element *debut, Element *fin) {
+   if (!atomic_load_explicit(&restitutionActive, memory_order_relaxed)) {
+      return false;
+   }
+   fin->suivant = NULL;
+   pthread_mutex_lock(&restitution.verrou);
+   if (restitution.fin) {
+      restitution.fin->suivant = debut;
+   } else {
+      restitution.debut = debut;
+   }
+   restitution.fin = fin;
+   if (restitution.enArrierePlan) {
+      pthread_cond_signal(&restitution.travail);
+   }
+   pthread_mutex_unlock(&restitution.verrou);
+   return true;
+}
+
+Status activerRestitutionDifferee(bool enArrierePlan) {
+   if (atomic_load(&restitutionActive)) {
+      return OK;
+   }
+   if (enArrierePlan) {
+      restitution.arret = false;
+      if (pthread_create(&restitution.thread, NULL, restituerEnArrierePlan, NULL)) {
+         return MEMOIRE_INSUFFISANTE;
+      }
+   }
+   restitution.enArrierePlan = enArrierePlan;
+   atomic_store(&restitutionActive, true);
+   return OK;
+}
+
+size_t restituerElementsDifferes(size_t budget) {
+   if (!budget) {
+      return 0;
+   }
+   pthread_mutex_lock(&restitution.verrou);
+   Element *debut = restitution.debut;
+   size_t nombre = 0;
+   if (debut) {
+      // on coupe la chaîne d'attente après budget elements
+      Element *dernier = debut;
+      nombre = 1;
+      while (nombre < budget && dernier->suivant) {
+         dernier = dernier->suivant;
+         nombre++;
+      }
+      restitution.debut = dernier->suivant;
+      if (!restitution.debut) {
+         restitution.fin = NULL;
+      }
+      dernier->suivant = NULL;
+   }
+   pthread_mutex_unlock(&restitution.verrou);
+
+   restituerChaine(debut);
+   return nombre;
+}
+
+bool restitutionsEnAttente(void) {
+   pthread_mutex_lock(&restitution.verrou);
+   bool enAttente = restitution.debut || restitution.enCours;
+   pthread_mutex_unlock(&restitution.verrou);
+   return enAttente;
+}
+
+void attendreRestitutionsDifferees(void) {
+   if (!restitution.enArrierePlan) {
+      restituerElementsDifferes(SIZE_MAX);
+      return;
+   }
+   pthread_mutex_lock(&restitution.verrou);
+   while (restitution.debut || restitution.enCours) {
+      pthread_cond_wait(&restitution.termine, &restitution.verrou);
+   }
+   pthread_mutex_unlock(&restitution.verrou);
+}
+
+void desactiverRestitutionDifferee(void) {
+   if (!atomic_load(&restitutionActive)) {
+      return;
+   }
+   // les chaînes restituées à partir de maintenant le sont immédiatement
+   atomic_store(&restitutionActive, false);
+   if (restitution.enArrierePlan) {
+      pthread_mutex_lock(&restitution.verrou);
+      restitution.arret = true;
+      pthread_cond_signal(&restitution.travail);
+      pthread_mutex_unlock(&restitution.verrou);
+      // le thread restitue ce qui attend encore avant de se terminer
+      pthread_join(restitution.thread, NULL);
+      restitution.enArrierePlan = false;
+   } else {
+      restituerElementsDifferes(SIZE_MAX);
+   }
+}
@@ -0,0 +1,65 @@
+/*
+ -----------------------------------------------------------------------------------
+ Nom du fichier : restitution_differee.h
+ Auteur(s)      : Andre Costa, Amir Mouti, Ouweis Harun
+ Date creation  : 16.10.2026
+
+ Description    : Restitution différée des éléments des listes de
+                  listes_dynamiques.h : les chaînes d'éléments supprimées en
+                  bloc (vider, detruire, supprimerSelonCritere...) sont
+                  détachées en O(1) et restituées plus tard, par un thread
+                  d'arrière-plan ou par l'appelant, au rythme qu'il choisit.
+
+ Remarque(s)    : Non disponible avec LISTES_DEROULEES.
+                  Ne concerne que les listes sans réservoir : les éléments d'un
+                  réservoir lui sont déjà rendus en O(1). Les suppressions d'un
+                  seul élément (supprimerEnTete, ...) restent immédiates.
+                  Le mode est global ; activerRestitutionDifferee et
+                  desactiverRestitutionDifferee ne doivent pas être appelées
+                  pendant qu'un autre thread utilise la librairie.
+
+ Compilateur    : Mingw-w64 gcc 12.2.0
+ -----------------------------------------------------------------------------------
+*/
+
+#ifndef RESTITUTION_DIFFEREE_H
+#define RESTITUTION_DIFFEREE_H
+
+#include "listes_dynamiques.h"
+
+// ------------------------------------------------------------------------------
+// Active la restitution différée. Si enArrierePlan vaut true, un thread restitue
+// les éléments dès qu'ils lui sont confiés ; sinon, ils attendent un appel à
+// restituerElementsDifferes ou attendreRestitutionsDifferees.
+// Renvoie OK si le mode a été activé (ou l'était déjà) et MEMOIRE_INSUFFISANTE
+// si le thread n'a pas pu être créé.
+Status activerRestitutionDifferee(bool enArrierePlan);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Restitue, dans le thread appelant, au plus budget éléments en attente (les
+// plus anciens).
+// Renvoie le nombre d'éléments restitués.
+size_t restituerElementsDifferes(size_t budget);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Renvoie true si des éléments attendent d'être restitués (ou sont en cours de
+// restitution par le thread d'arrière-plan), false sinon.
+bool restitutionsEnAttente(void);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Attend que tous les éléments confiés jusqu'ici aient été restitués : par le
+// thread d'arrière-plan s'il existe, par le thread appelant sinon.
+void attendreRestitutionsDifferees(void);
+// ------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+// Restitue tous les éléments en attente, arrête le thread d'arrière-plan s'il
+// existe et revient à la restitution immédiate. À appeler avant la fin du
+// programme pour un arrêt déterministe.
+void desactiverRestitutionDifferee(void);
+// ------------------------------------------------------------------------------
+
+#endif